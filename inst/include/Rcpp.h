@@ -48,6 +48,7 @@
 #include <Rcpp/DottedPairImpl.h>
 #include <Rcpp/Function.h>
 #include <Rcpp/Language.h>
+#include <Rcpp/PreparedCall.h>
 #include <Rcpp/DottedPair.h>
 #include <Rcpp/Pairlist.h>
 #include <Rcpp/StretchyList.h>
@@ -72,6 +73,7 @@
 #endif
 
 #include <Rcpp/Nullable.h>
+#include <Rcpp/ArgumentDescriptor.h>
 
 #include <Rcpp/RNGScope.h>
 
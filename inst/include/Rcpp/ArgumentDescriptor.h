@@ -0,0 +1,196 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// ArgumentDescriptor.h: Rcpp R/C++ interface class library -- checking arguments of exported functions
+//
+// Copyright (C) 2026  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp_ArgumentDescriptor_h
+#define Rcpp_ArgumentDescriptor_h
+
+#include <RcppCommon.h>
+
+namespace Rcpp{
+
+    /**
+     * What an argument of an exported function accepts, derived from its
+     * C++ type by describe_argument<T>(). The wrappers generated for
+     * // [[Rcpp::export(check = true)]] functions hold one per argument in
+     * a static array and call check_arguments() before converting any of
+     * them, so that a bad argument fails at once with a message naming
+     * it, instead of in as<>() after the arguments before it have been
+     * converted.
+     *
+     * The checks only refuse what the conversion would refuse anyway;
+     * they never make an argument that used to work fail.
+     */
+    struct ArgumentDescriptor {
+        const char* name ;
+        unsigned int types ;    // bit i set when SEXPTYPE i is accepted, 0 for anything
+        R_xlen_t length ;       // length a vector must have, -1 for any
+        bool nullable ;         // whether NULL is accepted as well
+        const char* expected ;  // what is expected, for error messages
+    } ;
+
+    namespace internal{
+
+        inline unsigned int argument_number_types(){
+            return (1u << LGLSXP) | (1u << INTSXP) | (1u << REALSXP) | (1u << CPLXSXP) | (1u << RAWSXP) ;
+        }
+
+        inline ArgumentDescriptor make_argument_descriptor( unsigned int types, R_xlen_t length, const char* expected ){
+            ArgumentDescriptor desc = { "", types, length, false, expected } ;
+            return desc ;
+        }
+
+        template <typename T>
+        inline ArgumentDescriptor describe_argument__impl( ::Rcpp::traits::r_type_primitive_tag ){
+            return make_argument_descriptor( argument_number_types(), 1, "a single number" ) ;
+        }
+        template <typename T>
+        inline ArgumentDescriptor describe_argument__impl( ::Rcpp::traits::r_type_string_tag ){
+            return make_argument_descriptor( (1u << STRSXP) | (1u << CHARSXP), 1, "a single string" ) ;
+        }
+        template <typename T, typename Category>
+        inline ArgumentDescriptor describe_argument__impl( Category ){
+            return make_argument_descriptor( 0u, -1, "anything" ) ;
+        }
+
+        template <typename T>
+        inline ArgumentDescriptor describe_container__impl( ::Rcpp::traits::r_type_primitive_tag ){
+            return make_argument_descriptor( argument_number_types(), -1, "a numeric, logical or raw vector" ) ;
+        }
+        template <typename T>
+        inline ArgumentDescriptor describe_container__impl( ::Rcpp::traits::r_type_string_tag ){
+            return make_argument_descriptor( 1u << STRSXP, -1, "a character vector" ) ;
+        }
+        template <typename T, typename Category>
+        inline ArgumentDescriptor describe_container__impl( Category ){
+            return make_argument_descriptor( 0u, -1, "anything" ) ;
+        }
+
+        template <int RTYPE>
+        inline ArgumentDescriptor describe_vector(){
+            switch( RTYPE ){
+            case LGLSXP: case INTSXP: case REALSXP: case CPLXSXP: case RAWSXP:
+                return make_argument_descriptor( argument_number_types(), -1, "a numeric, logical or raw vector" ) ;
+            default:
+                return make_argument_descriptor( 0u, -1, "anything" ) ;
+            }
+        }
+
+        inline const char* exact_vector_name( int rtype ){
+            switch( rtype ){
+            case LGLSXP:  return "a logical vector" ;
+            case INTSXP:  return "an integer vector" ;
+            case REALSXP: return "a double vector" ;
+            case CPLXSXP: return "a complex vector" ;
+            case RAWSXP:  return "a raw vector" ;
+            default:      return "a vector" ;
+            }
+        }
+    }
+
+    namespace traits{
+
+        /**
+         * argument_traits<T>::describe() gives the ArgumentDescriptor of
+         * arguments of type T. Specialize it for types whose conversion
+         * accepts less than anything.
+         */
+        template <typename T>
+        struct argument_traits {
+            static ArgumentDescriptor describe(){
+                return ::Rcpp::internal::describe_argument__impl<T>( typename r_type_traits<T>::r_category() ) ;
+            }
+        } ;
+
+        template <int RTYPE, template <class> class StoragePolicy>
+        struct argument_traits< ::Rcpp::Vector<RTYPE,StoragePolicy> > {
+            static ArgumentDescriptor describe(){ return ::Rcpp::internal::describe_vector<RTYPE>() ; }
+        } ;
+        template <int RTYPE, template <class> class StoragePolicy>
+        struct argument_traits< ::Rcpp::Matrix<RTYPE,StoragePolicy> > {
+            static ArgumentDescriptor describe(){ return ::Rcpp::internal::describe_vector<RTYPE>() ; }
+        } ;
+
+        template <typename T, typename Allocator>
+        struct argument_traits< std::vector<T,Allocator> > {
+            static ArgumentDescriptor describe(){
+                return ::Rcpp::internal::describe_container__impl<T>( typename r_type_traits<T>::r_category() ) ;
+            }
+        } ;
+        template <typename T, typename Allocator>
+        struct argument_traits< std::deque<T,Allocator> > : argument_traits< std::vector<T> > {} ;
+        template <typename T, typename Allocator>
+        struct argument_traits< std::list<T,Allocator> > : argument_traits< std::vector<T> > {} ;
+
+        template <typename T>
+        struct argument_traits< ::Rcpp::span<T> > {
+            static ArgumentDescriptor describe(){
+                const int RTYPE = ::Rcpp::internal::span_rtype<typename remove_const<T>::type>::rtype ;
+                return ::Rcpp::internal::make_argument_descriptor( 1u << RTYPE, -1, ::Rcpp::internal::exact_vector_name(RTYPE) ) ;
+            }
+        } ;
+        template <int RTYPE>
+        struct argument_traits< ::Rcpp::ConstVectorView<RTYPE> > {
+            static ArgumentDescriptor describe(){
+                return ::Rcpp::internal::make_argument_descriptor( 1u << RTYPE, -1, ::Rcpp::internal::exact_vector_name(RTYPE) ) ;
+            }
+        } ;
+
+        template <typename T>
+        struct argument_traits< ::Rcpp::Nullable<T> > {
+            static ArgumentDescriptor describe(){
+                ArgumentDescriptor desc = argument_traits<T>::describe() ;
+                desc.nullable = true ;
+                return desc ;
+            }
+        } ;
+    }
+
+    /** the descriptor of an argument called name, of C++ type T */
+    template <typename T>
+    inline ArgumentDescriptor describe_argument( const char* name ){
+        ArgumentDescriptor desc = traits::argument_traits< typename traits::remove_const_and_reference<T>::type >::describe() ;
+        desc.name = name ;
+        return desc ;
+    }
+
+    /**
+     * Checks the n arguments args against their descriptors in one pass,
+     * throwing not_compatible for the first one that does not match.
+     */
+    inline void check_arguments( const ArgumentDescriptor* desc, const SEXP* args, int n ){
+        for( int i=0; i<n; i++ ){
+            SEXP x = args[i] ;
+            const ArgumentDescriptor& d = desc[i] ;
+            if( d.nullable && Rf_isNull(x) ) continue ;
+            int type = TYPEOF(x) ;
+            bool ok = d.types == 0u || ( type < 32 && ( d.types & (1u << type) ) ) ;
+            if( ok && d.length >= 0 && Rf_isVector(x) && Rf_xlength(x) != d.length ) ok = false ;
+            if( ! ok ){
+                const char* fmt = "Invalid argument '%s': expecting %s%s [type=%s; extent=%i]." ;
+                throw ::Rcpp::not_compatible( fmt, d.name, d.expected, d.nullable ? " or NULL" : "",
+                    Rf_type2char(type), Rf_isVector(x) ? Rf_xlength(x) : static_cast<R_xlen_t>(1) ) ;
+            }
+        }
+    }
+
+}
+
+#endif
@@ -31,9 +31,8 @@ namespace Rcpp{
     private:
         inline SEXP as_environment(SEXP x){
             if( Rf_isEnvironment(x) ) return x ;
-            SEXP asEnvironmentSym = Rf_install("as.environment");
             try {
-                Shield<SEXP> call(Rf_lang2(asEnvironmentSym, x));
+                Shield<SEXP> call(Rf_lang2(RCPP_SYMBOL("as.environment"), x));
                 return Rcpp_fast_eval(call, R_GlobalEnv);
             } catch( const eval_error& ex) {
                 const char* fmt = "Cannot convert object to an environment: "
@@ -162,13 +161,16 @@ namespace Rcpp{
          * @return true if the object exists in the environment
          */
         bool exists( const std::string& name ) const {
-            SEXP nameSym = Rf_install(name.c_str());
-#if R_VERSION < R_Version(4,5,0)
-            SEXP res = Rf_findVarInFrame( Storage::get__() , nameSym  ) ;
+            return exists( Symbol(name) ) ;
+        }
+
+        bool exists( Symbol name ) const {
+#if R_VERSION < R_Version(4,2,0)
+            SEXP res = Rf_findVarInFrame( Storage::get__() , name  ) ;
             return res != R_UnboundValue;
 #else
-            SEXP res = R_getVarEx(nameSym, Storage::get__(), FALSE, NULL);
-            return res != NULL;
+            // does not force promises, as exists() in R
+            return R_existsVarInFrame( Storage::get__(), name ) ;
 #endif
         }
 
@@ -184,9 +186,13 @@ namespace Rcpp{
          * @throw binding_is_locked if the binding is locked
          */
         bool assign( const std::string& name, SEXP x ) const{
-            if( exists( name) && bindingIsLocked(name) ) throw binding_is_locked(name) ;
-            SEXP nameSym = Rf_install(name.c_str());
-            Rf_defineVar( nameSym, x, Storage::get__() );
+            return assign( Symbol(name), x ) ;
+        }
+
+        bool assign( Symbol name, SEXP x ) const{
+            SEXP env = Storage::get__() ;
+            if( exists( name ) && R_BindingIsLocked( name, env ) ) throw binding_is_locked(name.c_str()) ;
+            Rf_defineVar( name, x, env );
             return true ;
         }
 
@@ -205,6 +211,9 @@ namespace Rcpp{
         template <typename WRAPPABLE>
         bool assign( const std::string& name, const WRAPPABLE& x) const ;
 
+        template <typename WRAPPABLE>
+        bool assign( Symbol name, const WRAPPABLE& x) const ;
+
         /**
          * @return true if this environment is locked
          * see ?environmentIsLocked for details of what this means
@@ -217,20 +226,27 @@ namespace Rcpp{
          * remove an object from this environment
          */
         bool remove( const std::string& name ){
+            return remove( Symbol(name) ) ;
+        }
+
+        bool remove( Symbol name ){
+            SEXP env = Storage::get__() ;
             if( exists(name) ){
-                if( bindingIsLocked(name) ){
-                    throw binding_is_locked(name) ;
+                if( R_BindingIsLocked(name, env) ){
+                    throw binding_is_locked(name.c_str()) ;
                 } else{
+#if R_VERSION < R_Version(4,2,0)
                     /* unless we want to copy all of do_remove,
                        we have to go back to R to do this operation */
-                    SEXP internalSym = Rf_install( ".Internal" );
-                    SEXP removeSym = Rf_install( "remove" );
                     Shield<SEXP> str(Rf_mkString(name.c_str()));
-                    Shield<SEXP> call(Rf_lang2(internalSym, Rf_lang4(removeSym, str, Storage::get__(), Rf_ScalarLogical(FALSE))));
+                    Shield<SEXP> call(Rf_lang2(RCPP_SYMBOL(".Internal"), Rf_lang4(RCPP_SYMBOL("remove"), str, env, Rf_ScalarLogical(FALSE))));
                     Rcpp_fast_eval( call, R_GlobalEnv ) ;
+#else
+                    R_removeVarFromFrame( name, env ) ;
+#endif
                 }
             } else{
-                throw no_such_binding(name) ;
+                throw no_such_binding(name.c_str()) ;
             }
             return true;
         }
@@ -251,9 +267,12 @@ namespace Rcpp{
          * @throw no_such_binding if there is no such binding in this environment
          */
         void lockBinding(const std::string& name){
-            if( !exists( name) ) throw no_such_binding(name) ;
-            SEXP nameSym = Rf_install(name.c_str());
-            R_LockBinding( nameSym, Storage::get__() );
+            lockBinding( Symbol(name) ) ;
+        }
+
+        void lockBinding(Symbol name){
+            if( !exists( name) ) throw no_such_binding(name.c_str()) ;
+            R_LockBinding( name, Storage::get__() );
         }
 
         /**
@@ -263,9 +282,12 @@ namespace Rcpp{
          * @throw no_such_binding if there is no such binding in this environment
          */
         void unlockBinding(const std::string& name){
-            if( !exists( name) ) throw no_such_binding(name) ;
-            SEXP nameSym = Rf_install(name.c_str());
-            R_unLockBinding( nameSym, Storage::get__() );
+            unlockBinding( Symbol(name) ) ;
+        }
+
+        void unlockBinding(Symbol name){
+            if( !exists( name) ) throw no_such_binding(name.c_str()) ;
+            R_unLockBinding( name, Storage::get__() );
         }
 
         /**
@@ -277,9 +299,12 @@ namespace Rcpp{
          * @throw no_such_binding if there is no such binding in this environment
          */
         bool bindingIsLocked(const std::string& name) const{
-            if( !exists( name) ) throw no_such_binding(name) ;
-            SEXP nameSym = Rf_install(name.c_str());
-            return R_BindingIsLocked(nameSym, Storage::get__() ) ;
+            return bindingIsLocked( Symbol(name) ) ;
+        }
+
+        bool bindingIsLocked(Symbol name) const{
+            if( !exists( name) ) throw no_such_binding(name.c_str()) ;
+            return R_BindingIsLocked(name, Storage::get__() ) ;
         }
 
         /**
@@ -292,9 +317,12 @@ namespace Rcpp{
          * @throw no_such_binding if there is no such binding in this environment
          */
         bool bindingIsActive(const std::string& name) const {
-            if( !exists( name) ) throw no_such_binding(name) ;
-            SEXP nameSym = Rf_install(name.c_str());
-            return R_BindingIsActive(nameSym, Storage::get__()) ;
+            return bindingIsActive( Symbol(name) ) ;
+        }
+
+        bool bindingIsActive(Symbol name) const {
+            if( !exists( name) ) throw no_such_binding(name.c_str()) ;
+            return R_BindingIsActive(name, Storage::get__()) ;
         }
 
         /**
@@ -342,9 +370,8 @@ namespace Rcpp{
         static Environment_Impl namespace_env(const std::string& package){
             Armor<SEXP> env ;
             try{
-                SEXP getNamespaceSym = Rf_install("getNamespace");
                 Shield<SEXP> package_str( Rf_mkString(package.c_str()) );
-                Shield<SEXP> call( Rf_lang2(getNamespaceSym, package_str) );
+                Shield<SEXP> call( Rf_lang2(RCPP_SYMBOL("getNamespace"), package_str) );
                 env = Rcpp_fast_eval(call, R_GlobalEnv);
             } catch( ... ){
                 throw no_such_namespace( package  ) ;
@@ -367,8 +394,7 @@ namespace Rcpp{
          * creates a new environment whose this is the parent
          */
         Environment_Impl new_child(bool hashed) const {
-            SEXP newEnvSym = Rf_install("new.env");
-            Shield<SEXP> call(Rf_lang3(newEnvSym, Rf_ScalarLogical(hashed), Storage::get__()));
+            Shield<SEXP> call(Rf_lang3(RCPP_SYMBOL("new.env"), Rf_ScalarLogical(hashed), Storage::get__()));
             return Environment_Impl(Rcpp_fast_eval(call, R_GlobalEnv));
         }
 
@@ -62,6 +62,16 @@ namespace Rcpp{
             get_function(name, R_GlobalEnv);
         }
 
+        /**
+         * Finds a function from its symbol, for instance RCPP_SYMBOL("optim")
+         */
+        Function_Impl(Symbol name, const SEXP env = R_GlobalEnv) {
+            if (!Rf_isEnvironment(env)) {
+                stop("env is not an environment");
+            }
+            get_function(name, env);
+        }
+
         Function_Impl(const std::string& name, const SEXP env) {
             if (!Rf_isEnvironment(env)) {
                 stop("env is not an environment");
@@ -127,8 +137,11 @@ namespace Rcpp{
 
     private:
         void get_function(const std::string& name, const SEXP env) {
-            SEXP nameSym = Rf_install( name.c_str() );	// cannot be gc()'ed  once in symbol table
-            Shield<SEXP> x( Rf_findFun( nameSym, env ) ) ;
+            get_function(Symbol(name), env);	// cannot be gc()'ed  once in symbol table
+        }
+
+        void get_function(Symbol name, const SEXP env) {
+            Shield<SEXP> x( Rf_findFun( name, env ) ) ;
             Storage::set__(x) ;
         }
 
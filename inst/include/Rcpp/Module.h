@@ -432,6 +432,98 @@ namespace Rcpp{
 
 
 
+    namespace internal {
+
+        // a property of n objects as one vector: an atomic vector for
+        // numbers, logicals and strings, filled without an R object per
+        // element, and a list of wrapped values otherwise
+        template <typename PROP, typename Class, typename Getter>
+        SEXP property_column__impl( Class** objects, R_xlen_t n, Getter get, ::Rcpp::traits::r_type_primitive_tag ){
+            const int RTYPE = ::Rcpp::traits::r_sexptype_traits<PROP>::rtype ;
+            typedef typename ::Rcpp::traits::storage_type<RTYPE>::type STORAGE ;
+            Shield<SEXP> out( Rf_allocVector( RTYPE, n ) ) ;
+            STORAGE* start = r_vector_start<RTYPE>( out ) ;
+            for( R_xlen_t i=0; i<n; i++ ) start[i] = caster<PROP,STORAGE>( get( objects[i] ) ) ;
+            return out ;
+        }
+        template <typename PROP, typename Class, typename Getter>
+        SEXP property_column__impl( Class** objects, R_xlen_t n, Getter get, ::Rcpp::traits::r_type_string_tag ){
+            Shield<SEXP> out( Rf_allocVector( STRSXP, n ) ) ;
+            for( R_xlen_t i=0; i<n; i++ ) SET_STRING_ELT( out, i, make_charsexp( get( objects[i] ) ) ) ;
+            return out ;
+        }
+        template <typename PROP, typename Class, typename Getter, typename Category>
+        SEXP property_column__impl( Class** objects, R_xlen_t n, Getter get, Category ){
+            Shield<SEXP> out( Rf_allocVector( VECSXP, n ) ) ;
+            for( R_xlen_t i=0; i<n; i++ ) SET_VECTOR_ELT( out, i, ::Rcpp::wrap( get( objects[i] ) ) ) ;
+            return out ;
+        }
+        template <typename PROP, typename Class, typename Getter>
+        SEXP property_column( Class** objects, R_xlen_t n, Getter get ){
+            typedef typename ::Rcpp::traits::remove_const_and_reference<PROP>::type CLEAN ;
+            return property_column__impl<CLEAN>( objects, n, get, typename ::Rcpp::traits::r_type_traits<CLEAN>::r_category() ) ;
+        }
+
+        inline void check_column_length( R_xlen_t m, R_xlen_t n ){
+            if( m == 0 && n > 0 ) throw std::range_error( "zero length column" ) ;
+        }
+
+        // the reverse: element i of values, recycled, becomes the property
+        // of the i-th object
+        template <typename PROP, typename Class, typename Setter>
+        void set_property_column__impl( Class** objects, R_xlen_t n, SEXP values, Setter set, ::Rcpp::traits::r_type_primitive_tag ){
+            const int RTYPE = ::Rcpp::traits::r_sexptype_traits<PROP>::rtype ;
+            typedef typename ::Rcpp::traits::storage_type<RTYPE>::type STORAGE ;
+            Shield<SEXP> column( r_cast<RTYPE>( values ) ) ;
+            R_xlen_t m = Rf_xlength( column ) ;
+            check_column_length( m, n ) ;
+            STORAGE* start = r_vector_start<RTYPE>( column ) ;
+            for( R_xlen_t i=0; i<n; i++ ) set( objects[i], caster<STORAGE,PROP>( start[ i % m ] ) ) ;
+        }
+        template <typename PROP, typename Class, typename Setter>
+        void set_property_column__impl( Class** objects, R_xlen_t n, SEXP values, Setter set, ::Rcpp::traits::r_type_string_tag ){
+            Shield<SEXP> column( r_cast<STRSXP>( values ) ) ;
+            R_xlen_t m = Rf_xlength( column ) ;
+            check_column_length( m, n ) ;
+            for( R_xlen_t i=0; i<n; i++ ) set( objects[i], ::Rcpp::as<PROP>( STRING_ELT( column, i % m ) ) ) ;
+        }
+        template <typename PROP, typename Class, typename Setter, typename Category>
+        void set_property_column__impl( Class** objects, R_xlen_t n, SEXP values, Setter set, Category ){
+            if( TYPEOF(values) != VECSXP ){
+                // one value for all objects
+                PROP value = ::Rcpp::as<PROP>( values ) ;
+                for( R_xlen_t i=0; i<n; i++ ) set( objects[i], value ) ;
+                return ;
+            }
+            R_xlen_t m = Rf_xlength( values ) ;
+            check_column_length( m, n ) ;
+            for( R_xlen_t i=0; i<n; i++ ) set( objects[i], ::Rcpp::as<PROP>( VECTOR_ELT( values, i % m ) ) ) ;
+        }
+        template <typename PROP, typename Class, typename Setter>
+        void set_property_column( Class** objects, R_xlen_t n, SEXP values, Setter set ){
+            typedef typename ::Rcpp::traits::remove_const_and_reference<PROP>::type CLEAN ;
+            set_property_column__impl<CLEAN>( objects, n, values, set, typename ::Rcpp::traits::r_type_traits<CLEAN>::r_category() ) ;
+        }
+
+        // tag of the external pointers made by object_vector_xptr
+        template <typename Class>
+        inline const char* object_vector_tag(){
+            return typeid( std::vector<Class> ).name() ;
+        }
+    }
+
+    /**
+     * Wraps a vector of objects of an exposed class in an external pointer
+     * that getFields() and setFields() accept. The pointer is tagged with
+     * the type of the vector, and any other external pointer is refused.
+     * With set_delete_finalizer the vector is deleted with the pointer.
+     */
+    template <typename Class>
+    XPtr< std::vector<Class> > object_vector_xptr( std::vector<Class>* v, bool set_delete_finalizer = true ){
+        Shield<SEXP> tag( Rf_mkString( internal::object_vector_tag<Class>() ) ) ;
+        return XPtr< std::vector<Class> >( v, set_delete_finalizer, tag ) ;
+    }
+
     template <typename Class>
     class CppProperty {
     public:
@@ -444,6 +536,17 @@ namespace Rcpp{
         virtual bool is_readonly(){ return false; }
         virtual std::string get_class(){ return ""; }
 
+        // the property of n objects as one vector, and the reverse
+        virtual SEXP get_many(Class** objects, R_xlen_t n) {
+            return internal::property_column<SEXP>( objects, n, [this](Class* object){ return get(object); } ) ;
+        }
+        virtual void set_many(Class** objects, R_xlen_t n, SEXP values) {
+            for( R_xlen_t i=0; i<n; i++ ){
+                Shield<SEXP> value( internal::recycled_element( values, i ) ) ;
+                set( objects[i], value ) ;
+            }
+        }
+
         std::string docstring ;
     } ;
 
@@ -459,6 +562,14 @@ namespace Rcpp{
 
         SEXP get( Class* obj ){ return parent_property->get( (Parent*)obj ) ; }
         void set( Class* obj, SEXP s) { parent_property->set( (Parent*)obj, s ) ; }
+        SEXP get_many( Class** objects, R_xlen_t n ){
+            std::vector<Parent*> parents( objects, objects + n ) ;
+            return parent_property->get_many( n ? &parents[0] : 0, n ) ;
+        }
+        void set_many( Class** objects, R_xlen_t n, SEXP values ){
+            std::vector<Parent*> parents( objects, objects + n ) ;
+            parent_property->set_many( n ? &parents[0] : 0, n, values ) ;
+        }
         bool is_readonly(){ return parent_property->is_readonly() ; }
         std::string get_class(){ return parent_property->get_class() ; }
 
@@ -590,6 +701,7 @@ namespace Rcpp {
 	        slot( "typeid" )      = cl->get_typeinfo_name() ;
 	        slot( "enums"  )      = cl->enums ;
 	        slot( "parents" )     = cl->parents ;
+	        slot( "lightweight" ) = cl->lightweight_objects ;
 	    }
 
 	    RCPP_CTOR_ASSIGN_WITH_BASE(CppClass)
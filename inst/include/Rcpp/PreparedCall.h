@@ -0,0 +1,158 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// PreparedCall.h: Rcpp R/C++ interface class library -- repeated calls to an R function
+//
+// Copyright (C) 2026  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp_PreparedCall_h
+#define Rcpp_PreparedCall_h
+
+#include <RcppCommon.h>
+
+namespace Rcpp{
+
+    /**
+     * A call to an R function built once and evaluated many times, for
+     * instance an objective function called from an optimizer. Calling a
+     * Function allocates the argument pairlist, the call and an unwind
+     * token every time; a PreparedCall keeps all three and only replaces
+     * the arguments that change.
+     *
+     * The arguments given to the constructor fix the number of argument
+     * slots and their names:
+     *
+     * PreparedCall f( fun, 0.0, Named("data") = data ) ;
+     * for( ... ){
+     *     double value = as<double>( f( x ) ) ;  // sets slot 0, evaluates
+     * }
+     *
+     * Scalars set from int, double or bool are written into the length
+     * one vector already in the slot when nothing but the call refers to
+     * it, so a loop such as the one above allocates nothing on the C++
+     * side. When the function kept a reference to its argument, a new
+     * vector is made instead.
+     */
+    class PreparedCall {
+    public:
+
+        template <typename... T>
+        PreparedCall(const Function& fun, const T&... args) : env(R_GlobalEnv) {
+            Shield<SEXP> arglist(pairlist(args...));
+            call = Rcpp_lcons(fun, arglist);
+            for (SEXP cell = CDR(call); cell != R_NilValue; cell = CDR(cell)) {
+                cells.push_back(cell);
+                owned.push_back(false);
+            }
+        }
+
+        /** number of argument slots */
+        inline int size() const { return static_cast<int>(cells.size()); }
+
+        /** environment the call is evaluated in, the global environment by default */
+        inline PreparedCall& set_env(SEXP env_) {
+            if (!Rf_isEnvironment(env_)) stop("env is not an environment");
+            env = env_;
+            return *this;
+        }
+
+        template <typename T>
+        inline PreparedCall& set(int i, const T& value) {
+            SEXP cell = get_cell(i);
+            SETCAR(cell, wrap(value));
+            owned[i] = false;
+            return *this;
+        }
+        inline PreparedCall& set(int i, double value) {
+            *scalar_slot<REALSXP>(i) = value;
+            return *this;
+        }
+        inline PreparedCall& set(int i, int value) {
+            *scalar_slot<INTSXP>(i) = value;
+            return *this;
+        }
+        inline PreparedCall& set(int i, bool value) {
+            *scalar_slot<LGLSXP>(i) = value;
+            return *this;
+        }
+
+        /** the current value of slot i */
+        inline SEXP get(int i) const {
+            return CAR(get_cell(i));
+        }
+
+        /** evaluates the call with the arguments as they are */
+        SEXP operator()() const {
+            return scope.eval(call, env);
+        }
+
+        /** sets the first slots to args, then evaluates */
+        template <typename U, typename... T>
+        SEXP operator()(const U& head, const T&... tail) {
+            int n = static_cast<int>(sizeof...(T)) + 1;
+            if (n > size()) {
+                stop("%d arguments given to a call prepared with %d", n, size());
+            }
+            set_args(0, head, tail...);
+            return static_cast<const PreparedCall&>(*this)();
+        }
+
+        inline SEXP get_call() const { return call; }
+
+    private:
+
+        inline SEXP get_cell(int i) const {
+            if (i < 0 || i >= size()) {
+                stop("argument slot %d out of range [0, %d)", i, size());
+            }
+            return cells[i];
+        }
+
+        // The length one vector of slot i to write to: the one already
+        // there if this object made it and nobody else can see it,
+        // otherwise a new one.
+        template <int RTYPE>
+        typename traits::storage_type<RTYPE>::type* scalar_slot(int i) {
+            typedef typename traits::storage_type<RTYPE>::type STORAGE;
+            SEXP cell = get_cell(i);
+            SEXP x = CAR(cell);
+            if (!owned[i] || TYPEOF(x) != RTYPE || MAYBE_SHARED(x)) {
+                x = Rf_allocVector(RTYPE, 1);
+                SETCAR(cell, x);
+                owned[i] = true;
+            }
+            return reinterpret_cast<STORAGE*>(dataptr(x));
+        }
+
+        inline void set_args(int) {}
+
+        template <typename U, typename... T>
+        inline void set_args(int i, const U& head, const T&... tail) {
+            set(i, head);
+            set_args(i + 1, tail...);
+        }
+
+        RObject call;
+        RObject env;
+        mutable UnwindScope scope;  // one continuation token for all evaluations
+        std::vector<SEXP> cells;    // the cons cells of the arguments, kept alive by call
+        std::vector<bool> owned;    // whether the value in the cell was allocated here
+    };
+
+} // namespace Rcpp
+
+#endif
@@ -0,0 +1,233 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// StringBuilder.h: Rcpp R/C++ interface class library -- incremental string building
+//
+// Copyright (C) 2026  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp__StringBuilder_h
+#define Rcpp__StringBuilder_h
+
+#include <cstdio>
+#include <cmath>
+
+#if __cplusplus >= 201703L && defined(__has_include)
+    #if __has_include(<charconv>)
+        #include <charconv>
+    #endif
+#endif
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    #define RCPP_HAS_TO_CHARS
+#endif
+
+namespace Rcpp {
+
+    namespace internal {
+        inline double string_builder_pow10( int digits ){
+            static const double powers[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8,
+                1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17 } ;
+            return powers[digits] ;
+        }
+    }
+
+    /**
+     * Accumulates text in a single growable buffer and turns it into a
+     * CHARSXP with get_sexp(), or a length one character vector with
+     * wrap(), only when asked to. There is no implicit conversion to SEXP,
+     * as a bare CHARSXP is not a valid R value.
+     * Unlike String, appending never goes back and forth between R and
+     * std::string and nothing is protected until the result is made.
+     *
+     * StringBuilder sb ;
+     * for( int i=0; i<n; i++ ){
+     *     sb.clear() ;
+     *     sb << "{\"id\":" << ids[i] << ",\"value\":" << values[i] << '}' ;
+     *     out[i] = sb.get_sexp() ;
+     * }
+     *
+     * Numbers are formatted like printf's "%.15g" (the number of digits
+     * can be changed), except that whole numbers below 10^digits are
+     * written in full and missing values as R prints them: NA, NaN, Inf
+     * and -Inf.
+     */
+    class StringBuilder {
+    public:
+
+        StringBuilder( cetype_t enc_ = CE_UTF8 ) : buffer(), enc(enc_), digits(15) {}
+
+        StringBuilder( size_t capacity, cetype_t enc_ = CE_UTF8 ) : buffer(), enc(enc_), digits(15) {
+            buffer.reserve( capacity ) ;
+        }
+
+        inline StringBuilder& reserve( size_t capacity ){
+            buffer.reserve( capacity ) ;
+            return *this ;
+        }
+
+        /** empties the builder, keeping its memory for the next string */
+        inline StringBuilder& clear(){
+            buffer.clear() ;
+            return *this ;
+        }
+
+        inline size_t size() const { return buffer.size() ; }
+        inline bool empty() const { return buffer.empty() ; }
+
+        /** significant digits used for doubles, 15 by default */
+        inline StringBuilder& set_digits( int digits_ ){
+            if( digits_ < 1 || digits_ > 17 ) stop( "digits must be between 1 and 17" ) ;
+            digits = digits_ ;
+            return *this ;
+        }
+
+        inline StringBuilder& append( const char* s, size_t n ){
+            buffer.append( s, n ) ;
+            return *this ;
+        }
+        inline StringBuilder& append( const char* s ){
+            return append( s, std::strlen(s) ) ;
+        }
+        inline StringBuilder& append( const std::string& s ){
+            return append( s.data(), s.size() ) ;
+        }
+        inline StringBuilder& append( char c ){
+            buffer.push_back( c ) ;
+            return *this ;
+        }
+        inline StringBuilder& append( const String& s ){
+            return append( s.get_cstring() ) ;
+        }
+
+        /**
+         * appends a CHARSXP, or the only element of a character vector,
+         * converted to UTF-8 if that is the encoding of the builder.
+         * NA_STRING is written as NA.
+         */
+        inline StringBuilder& append( SEXP x ){
+            if( TYPEOF(x) == STRSXP ){
+                if( Rf_xlength(x) != 1 ){
+                    throw ::Rcpp::not_compatible( "Expecting a single string value: [extent=%i].", Rf_length(x) ) ;
+                }
+                x = STRING_ELT( x, 0 ) ;
+            }
+            if( TYPEOF(x) != CHARSXP ){
+                throw ::Rcpp::not_compatible( "Expecting a string: [type=%s].", Rf_type2char( TYPEOF(x) ) ) ;
+            }
+            if( x == NA_STRING ) return append( "NA", 2 ) ;
+            if( enc == CE_UTF8 && Rf_getCharCE(x) != CE_UTF8 ){
+                return append( Rf_translateCharUTF8(x) ) ;
+            }
+            return append( CHAR(x), LENGTH(x) ) ;
+        }
+
+        template <template <class> class StoragePolicy>
+        inline StringBuilder& append( const internal::string_proxy<STRSXP,StoragePolicy>& x ){
+            return append( x.get() ) ;
+        }
+        template <template <class> class StoragePolicy>
+        inline StringBuilder& append( const internal::const_string_proxy<STRSXP,StoragePolicy>& x ){
+            return append( x.get() ) ;
+        }
+
+        inline StringBuilder& append( int x ){
+            if( x == NA_INTEGER ) return append( "NA", 2 ) ;
+            return append_integer( static_cast<long long>(x) ) ;
+        }
+        inline StringBuilder& append( long x ){ return append_integer( static_cast<long long>(x) ) ; }
+        inline StringBuilder& append( long long x ){ return append_integer( x ) ; }
+        inline StringBuilder& append( unsigned int x ){ return append_unsigned( x ) ; }
+        inline StringBuilder& append( unsigned long x ){ return append_unsigned( x ) ; }
+        inline StringBuilder& append( unsigned long long x ){ return append_unsigned( x ) ; }
+
+        inline StringBuilder& append( double x ){
+            if( ISNAN(x) ){
+                return internal::Rcpp_IsNA(x) ? append( "NA", 2 ) : append( "NaN", 3 ) ;
+            }
+            if( std::isinf(x) ) return x > 0 ? append( "Inf", 3 ) : append( "-Inf", 4 ) ;
+            // whole numbers are the most common and have an exact, cheap form
+            if( x == std::floor(x) && std::fabs(x) < internal::string_builder_pow10( digits ) ){
+                return append_integer( static_cast<long long>(x) ) ;
+            }
+            char tmp[32] ;
+#if defined(RCPP_HAS_TO_CHARS)
+            std::to_chars_result res = std::to_chars( tmp, tmp + sizeof(tmp), x, std::chars_format::general, digits ) ;
+            return append( tmp, res.ptr - tmp ) ;
+#else
+            int n = snprintf( tmp, sizeof(tmp), "%.*g", digits, x ) ;
+            return append( tmp, n ) ;
+#endif
+        }
+
+        template <typename T>
+        inline StringBuilder& operator<<( const T& x ){
+            return append( x ) ;
+        }
+        inline StringBuilder& operator<<( const char* s ){
+            return append( s ) ;
+        }
+
+        /** the text so far, not NUL terminated */
+        inline const char* data() const { return buffer.data() ; }
+        inline std::string str() const { return buffer ; }
+
+        /** the content as a CHARSXP, created here */
+        inline SEXP get_sexp() const {
+            if( buffer.size() > static_cast<size_t>( INT_MAX ) ){
+                stop( "R character strings are limited to 2^31-1 bytes" ) ;
+            }
+            return Rf_mkCharLenCE( buffer.data(), static_cast<int>( buffer.size() ), enc ) ;
+        }
+
+        inline cetype_t get_encoding() const { return enc ; }
+
+    private:
+
+        inline StringBuilder& append_integer( long long x ){
+            if( x < 0 ){
+                buffer.push_back( '-' ) ;
+                // negate in unsigned arithmetic so that LLONG_MIN works
+                return append_unsigned( 0ULL - static_cast<unsigned long long>(x) ) ;
+            }
+            return append_unsigned( static_cast<unsigned long long>(x) ) ;
+        }
+
+        inline StringBuilder& append_unsigned( unsigned long long x ){
+            char tmp[24] ;
+            char* end = tmp + sizeof(tmp) ;
+            char* p = end ;
+            do {
+                *--p = static_cast<char>( '0' + x % 10 ) ;
+                x /= 10 ;
+            } while( x ) ;
+            return append( p, end - p ) ;
+        }
+
+        std::string buffer ;
+        cetype_t enc ;
+        int digits ;
+    } ;
+
+    template <>
+    inline SEXP wrap<Rcpp::StringBuilder>( const Rcpp::StringBuilder& object ){
+        Shield<SEXP> res( Rf_allocVector( STRSXP, 1 ) ) ;
+        SET_STRING_ELT( res, 0, object.get_sexp() ) ;
+        return res ;
+    }
+
+} // Rcpp
+
+#endif
@@ -77,4 +77,13 @@ namespace Rcpp{
 
 } // namespace Rcpp
 
+// The symbol for a string literal, installed the first time the
+// expression is evaluated and kept in a static for every later
+// evaluation at the same place; symbols are never garbage collected.
+// Saves hashing the name and searching the symbol table in loops:
+//
+//   double tol = as<double>(env.get(RCPP_SYMBOL("tolerance")));
+#define RCPP_SYMBOL(__NAME__) \
+    ::Rcpp::Symbol([]() -> SEXP { static SEXP sym = ::Rf_install(__NAME__); return sym; }())
+
 #endif
@@ -54,6 +54,8 @@ namespace Rcpp{
 
 #include <Rcpp/vector/DimNameProxy.h>
 
+#include <Rcpp/vector/tiled.h>
+
 #include <Rcpp/vector/Matrix.h>
 #include <Rcpp/vector/SubMatrix.h>
 #include <Rcpp/vector/MatrixRow.h>
@@ -66,10 +68,13 @@ namespace Rcpp{
 #include <Rcpp/vector/const_generic_proxy.h>
 
 #include <Rcpp/String.h>
+#include <Rcpp/StringBuilder.h>
 #include <Rcpp/vector/LazyVector.h>
 #include <Rcpp/vector/swap.h>
 
 #include <Rcpp/vector/ChildVector.h>
 #include <Rcpp/vector/ListOf.h>
+#include <Rcpp/vector/span.h>
+#include <Rcpp/vector/lazy_wrap.h>
 
 #endif
@@ -28,6 +28,17 @@ namespace Rcpp{
     }
 
     inline Date::Date(const std::string &s, const std::string &fmt) {
+        // formats the C++ parser knows are read without a trip to R
+        internal::parsed_time pt;
+        if (internal::datetime_parse_format_ok(fmt.c_str()) &&
+            internal::datetime_parse(s.c_str(), fmt.c_str(), pt)) {
+            double secs = internal::datetime_seconds(pt);
+            if (R_FINITE(secs)) {
+                m_d = std::floor(secs / 86400.0);
+                update_tm();
+                return;
+            }
+        }
         Function strptime("strptime");	// we cheat and call strptime() from R
         Function asDate("as.Date");	// and we need to convert to Date
         m_d = Rcpp::as<int>(asDate(strptime(s, fmt, "UTC")));
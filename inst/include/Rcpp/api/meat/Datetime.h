@@ -28,6 +28,20 @@ namespace Rcpp {
     }
 
     inline Datetime::Datetime(const std::string &s, const std::string &fmt) {
+        // strptime() reads the time in the time zone of the session, which
+        // the C++ parser does not know, so it is only used when the string
+        // carries its offset from UTC
+        internal::parsed_time pt;
+        if (internal::datetime_format_has_offset(fmt.c_str()) &&
+            internal::datetime_parse_format_ok(fmt.c_str()) &&
+            internal::datetime_parse(s.c_str(), fmt.c_str(), pt)) {
+            double secs = internal::datetime_seconds(pt);
+            if (R_FINITE(secs)) {
+                m_dt = secs;
+                update_tm();
+                return;
+            }
+        }
         Rcpp::Function strptime("strptime");    // we cheat and call strptime() from R
         Rcpp::Function asPOSIXct("as.POSIXct"); // and we need to convert to POSIXct
         m_dt = Rcpp::as<double>(asPOSIXct(strptime(s, fmt)));
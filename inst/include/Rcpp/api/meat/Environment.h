@@ -30,6 +30,13 @@ bool Environment_Impl<StoragePolicy>::assign( const std::string& name, const WRA
     return assign(name, Shield<SEXP>(wrap(x)));
 }
 
+template <template <class> class StoragePolicy>
+template <typename WRAPPABLE>
+bool Environment_Impl<StoragePolicy>::assign( Symbol name, const WRAPPABLE& x) const {
+    Shield<SEXP> wrapped(wrap(x));
+    return assign(name, (SEXP) wrapped);
+}
+
 template <template <class> class StoragePolicy>
 Environment_Impl<StoragePolicy>::Environment_Impl( const std::string& name ){
     Shield<SEXP> wrapped(wrap(name));
@@ -21,7 +21,19 @@
 namespace Rcpp{
 namespace internal{
 
-    inline void* as_module_object_internal(SEXP obj){
+    inline void* as_module_object_internal(SEXP obj, const char* type_name){
+        // objects of classes declared lightweight() are the pointer itself,
+        // tagged with the class; any other external pointer is refused
+        if( TYPEOF(obj) == EXTPTRSXP ){
+#ifndef RCPP_NO_MODULES
+            SEXP tag = R_ExternalPtrTag(obj) ;
+            class_Base* cl = TYPEOF(tag) == EXTPTRSXP ? reinterpret_cast<class_Base*>( R_ExternalPtrAddr(tag) ) : 0 ;
+            if( Rf_inherits( obj, "Rcpp_lightweight" ) && cl != 0 && cl->has_typeinfo_name( type_name ) ){
+                return R_ExternalPtrAddr(obj) ;
+            }
+#endif
+            throw not_compatible( "Expecting an object of the exposed class '%s', got an external pointer.", demangle( type_name ) ) ;
+        }
         Environment env(obj) ;
         SEXP xp = env.get(".pointer") ;
         return R_ExternalPtrAddr(xp );
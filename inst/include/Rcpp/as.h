@@ -88,16 +88,26 @@ namespace Rcpp {
             return exporter.get();
         }
 
-        void* as_module_object_internal(SEXP obj);
+        void* as_module_object_internal(SEXP obj, const char* type_name);
+
+        // the name the module classes know T by, to check lightweight objects
+        template <typename T> inline const char* module_object_type_name() {
+#ifndef RCPP_NO_RTTI
+            return typeid(T).name();
+#else
+            return "";
+#endif
+        }
 
         template <typename T> object<T> as_module_object(SEXP x) {
-            return (T*) as_module_object_internal(x);
+            return (T*) as_module_object_internal(x, module_object_type_name<T>());
         }
 
         /** handling object<T> */
         template <typename T> T as(SEXP x, ::Rcpp::traits::r_type_module_object_const_pointer_tag) {
             typedef typename Rcpp::traits::remove_const<T>::type T_NON_CONST;
-            return const_cast<T>((T_NON_CONST)as_module_object_internal(x));
+            typedef typename traits::un_pointer<T_NON_CONST>::type KLASS;
+            return const_cast<T>((T_NON_CONST)as_module_object_internal(x, module_object_type_name<KLASS>()));
         }
 
         template <typename T> T as(SEXP x, ::Rcpp::traits::r_type_module_object_pointer_tag) {
@@ -155,6 +165,23 @@ namespace Rcpp {
         return internal::check_single_string(x)[0];
     }
 
+    /**
+     * Converts a logical, integer, numeric or raw vector to a container of
+     * numbers such as std::vector<float>, choosing what happens to missing
+     * values (see ExportNA):
+     *
+     * std::vector<int> x = as_with_na< std::vector<int> >( v, ExportNA<int>::stop() ) ;
+     *
+     * This is not an overload of as<T>, so that as<T> can still be passed
+     * as a function.
+     */
+    template <typename T>
+    T as_with_na(SEXP x, const ExportNA<typename T::value_type>& na) {
+        T res( ::Rf_xlength(x) );
+        internal::export_range__impl<typename T::iterator, typename T::value_type>(x, res.begin(), na);
+        return res;
+    }
+
     template <typename T>
     inline typename traits::remove_const_and_reference<T>::type bare_as(SEXP x) {
         return as< typename traits::remove_const_and_reference<T>::type >(x);
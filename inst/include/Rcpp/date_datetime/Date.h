@@ -63,8 +63,8 @@ namespace Rcpp {
                 m_tm.tm_year  = year - baseYear();
             }
             double tmp = mktime00(m_tm);    // use mktime() replacement borrowed from R
-            m_tm.tm_year += baseYear();    // we'd rather keep it as a normal year
             m_d = tmp/(24*60*60);
+            update_tm();                    // fields follow m_d, also for days such as Feb 30
         }
 
         double getDate(void) const {
@@ -75,11 +75,11 @@ namespace Rcpp {
         //int getSeconds() const { return m_tm.tm_sec; }
         //int getMinutes() const { return m_tm.tm_min; }
         //int getHours()   const { return m_tm.tm_hour; }
-        int getDay()     const { return m_tm.tm_mday; }
-        int getMonth()   const { return m_tm.tm_mon + 1; }      // makes it 1 .. 12
-        int getYear()    const { return m_tm.tm_year; }         // does include 1900 (see Date.cpp)
-        int getWeekday() const { return m_tm.tm_wday + 1; }     // makes it 1 .. 7
-        int getYearday() const { return m_tm.tm_yday + 1; }     // makes it 1 .. 366
+        int getDay()     const { return get_tm().tm_mday; }
+        int getMonth()   const { return get_tm().tm_mon + 1; }      // makes it 1 .. 12
+        int getYear()    const { return get_tm().tm_year; }         // does include 1900 (see Date.cpp)
+        int getWeekday() const { return get_tm().tm_wday + 1; }     // makes it 1 .. 7
+        int getYearday() const { return get_tm().tm_yday + 1; }     // makes it 1 .. 366
 
         // 1900 as per POSIX mktime() et al
         static inline unsigned int baseYear() {
@@ -106,7 +106,7 @@ namespace Rcpp {
 
         inline std::string format(const char *fmt = "%Y-%m-%d") const {
             char txt[32];
-            struct tm temp = m_tm;
+            struct tm temp = get_tm();
             temp.tm_year -= baseYear();    // adjust for fact that system has year rel. to 1900
             size_t res = ::strftime(txt, 31, fmt, &temp);
             if (res == 0) {
@@ -120,17 +120,25 @@ namespace Rcpp {
 
     private:
         double m_d;                 // (fractional) day number, relative to epoch of Jan 1, 1970
-        struct tm m_tm;             // standard time representation
+        mutable struct tm m_tm;     // standard time representation, filled on first use
+        mutable bool m_tm_ok;       // whether m_tm matches m_d
 
-        // update m_tm based on m_d
+        // m_d changed, m_tm is recomputed when a field is asked for
         void update_tm() {
-            if (R_FINITE(m_d)) {
-                time_t t = static_cast<time_t>(24*60*60 * m_d);      // (fractional) days since epoch to seconds since epoch
-                m_tm = *gmtime_(&t);
-            } else {
-                m_tm.tm_sec = m_tm.tm_min = m_tm.tm_hour = m_tm.tm_isdst = NA_INTEGER;
-                m_tm.tm_min = m_tm.tm_hour = m_tm.tm_mday = m_tm.tm_mon  = m_tm.tm_year = NA_INTEGER;
+            m_tm_ok = false;
+        }
+
+        const struct tm& get_tm() const {
+            if (!m_tm_ok) {
+                if (R_FINITE(m_d)) {
+                    // (fractional) days since epoch to whole seconds since epoch
+                    internal::civil_to_tm(std::trunc(24*60*60 * m_d), m_tm);
+                } else {
+                    internal::civil_tm_na(m_tm);
+                }
+                m_tm_ok = true;
             }
+            return m_tm;
         }
 
     };
@@ -154,11 +162,7 @@ namespace Rcpp {
     }
 
     inline Date operator+(const Date &date, int offset) {
-        Date newdate(date.m_d);
-        newdate.m_d += offset;
-        time_t t = static_cast<time_t>(24*60*60 * newdate.m_d);  // days since epoch to seconds since epo
-        newdate.m_tm = *gmtime_(&t);
-        return newdate;
+        return Date(date.m_d + offset);
     }
 
     inline double operator-( const Date& d1, const Date& d2) { return d1.m_d -  d2.m_d; }
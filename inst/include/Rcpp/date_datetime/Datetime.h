@@ -46,15 +46,15 @@ namespace Rcpp {
 
         double getFractionalTimestamp(void) const { return m_dt; }
 
-        int getMicroSeconds() const { return m_us; }
-        int getSeconds()      const { return m_tm.tm_sec; }
-        int getMinutes()      const { return m_tm.tm_min; }
-        int getHours()        const { return m_tm.tm_hour; }
-        int getDay()          const { return m_tm.tm_mday; }
-        int getMonth()        const { return m_tm.tm_mon + 1; }      // makes it 1 .. 12
-        int getYear()         const { return m_tm.tm_year ; }
-        int getWeekday()      const { return m_tm.tm_wday + 1; }     // makes it 1 .. 7
-        int getYearday()      const { return m_tm.tm_yday + 1; }     // makes it 1 .. 366
+        int getMicroSeconds() const { get_tm(); return m_us; }
+        int getSeconds()      const { return get_tm().tm_sec; }
+        int getMinutes()      const { return get_tm().tm_min; }
+        int getHours()        const { return get_tm().tm_hour; }
+        int getDay()          const { return get_tm().tm_mday; }
+        int getMonth()        const { return get_tm().tm_mon + 1; }      // makes it 1 .. 12
+        int getYear()         const { return get_tm().tm_year ; }
+        int getWeekday()      const { return get_tm().tm_wday + 1; }     // makes it 1 .. 7
+        int getYearday()      const { return get_tm().tm_yday + 1; }     // makes it 1 .. 366
 
         // Minimal set of date operations.
         friend Datetime  operator+( const Datetime &dt, double offset);
@@ -79,7 +79,7 @@ namespace Rcpp {
             if (res == 0) {
                 return std::string("");
             } else {
-                res = ::snprintf(txtsec, 63, "%s.%06d", txtiso, m_us);
+                res = ::snprintf(txtsec, 63, "%s.%06d", txtiso, getMicroSeconds());
                 if (res <= 0) {
                     return std::string("");
                 } else {
@@ -92,23 +92,32 @@ namespace Rcpp {
 
     private:
         double m_dt;            // fractional seconds since epoch
-        struct tm m_tm;         // standard time representation
-        int m_us;               // microsecond (to complement m_tm)
+        mutable struct tm m_tm; // standard time representation, filled on first use
+        mutable int m_us;       // microsecond (to complement m_tm)
+        mutable bool m_tm_ok;   // whether m_tm and m_us match m_dt
 
-        // update m_tm based on m_dt
+        // m_dt changed, m_tm and m_us are recomputed when a field is asked for
         void update_tm() {
-            if (R_FINITE(m_dt)) {
-                double dt = std::floor(m_dt);
-                time_t t = static_cast<time_t>(dt);
-                m_tm = *gmtime_(&t);
-                // m_us is fractional (micro)secs as diff. between (fractional) m_dt and m_tm
-                m_us = static_cast<int>(::Rf_fround( (m_dt - dt) * 1.0e6, 0.0));
-            } else {
+            if (!R_FINITE(m_dt)) {
                 m_dt = NA_REAL;         // NaN and Inf need it set
-                m_tm.tm_sec = m_tm.tm_min = m_tm.tm_hour = m_tm.tm_isdst = NA_INTEGER;
-                m_tm.tm_min = m_tm.tm_hour = m_tm.tm_mday = m_tm.tm_mon  = m_tm.tm_year = NA_INTEGER;
-                m_us = NA_INTEGER;
             }
+            m_tm_ok = false;
+        }
+
+        const struct tm& get_tm() const {
+            if (!m_tm_ok) {
+                if (R_FINITE(m_dt)) {
+                    double dt = std::floor(m_dt);
+                    internal::civil_to_tm(dt, m_tm);
+                    // m_us is fractional (micro)secs as diff. between (fractional) m_dt and m_tm
+                    m_us = static_cast<int>(::Rf_fround( (m_dt - dt) * 1.0e6, 0.0));
+                } else {
+                    internal::civil_tm_na(m_tm);
+                    m_us = NA_INTEGER;
+                }
+                m_tm_ok = true;
+            }
+            return m_tm;
         }
 
         // 1900 as per POSIX mktime() et al
@@ -135,23 +144,11 @@ namespace Rcpp {
     template<> SEXP wrap_extra_steps<Rcpp::Datetime>(SEXP x);
 
     inline Datetime operator+(const Datetime &datetime, double offset) {
-        Datetime newdt(datetime.m_dt);
-        newdt.m_dt += offset;
-        double dt = std::floor(newdt.m_dt);
-        time_t t = static_cast<time_t>(dt);
-        newdt.m_tm = *gmtime_(&t);
-        newdt.m_us = static_cast<int>(::Rf_fround( (newdt.m_dt - dt) * 1.0e6, 0.0));
-        return newdt;
+        return Datetime(datetime.m_dt + offset);
     }
 
     inline Datetime operator+(const Datetime &datetime, int offset) {
-        Datetime newdt(datetime.m_dt);
-        newdt.m_dt += offset;
-        double dt = std::floor(newdt.m_dt);
-        time_t t = static_cast<time_t>(dt);
-        newdt.m_tm = *gmtime_(&t);
-        newdt.m_us = static_cast<int>(::Rf_fround( (newdt.m_dt - dt) * 1.0e6, 0.0));
-        return newdt;
+        return Datetime(datetime.m_dt + offset);
     }
 
     inline double  operator-(const Datetime& d1, const Datetime& d2) { return d1.m_dt - d2.m_dt; }
@@ -0,0 +1,170 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// civil.h: Rcpp R/C++ interface class library -- calendar arithmetic for
+//          Date and Datetime
+//
+// Copyright (C) 2026  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp__date_datetime__civil_h
+#define Rcpp__date_datetime__civil_h
+
+#include <cmath>
+#include <ctime>
+
+// below this many elements per thread date and time loops stay serial
+#ifndef RCPP_DATETIME_GRAIN
+#define RCPP_DATETIME_GRAIN 16384
+#endif
+
+namespace Rcpp {
+namespace internal {
+
+    // Calendar arithmetic on the proleptic Gregorian calendar, counting
+    // days from 1970-01-01 as R does. These give the same results as
+    // mktime00() and gmtime_() in src/date.cpp but take constant time,
+    // touch no static storage and can run on any thread.
+    // (algorithms by Howard Hinnant, "chrono-Compatible Low-Level Date
+    // Algorithms")
+
+    inline bool is_leap_year( int y ){
+        return ( y % 4 == 0 && y % 100 != 0 ) || y % 400 == 0 ;
+    }
+
+    inline int days_in_month( int y, int m ){
+        static const int days[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 } ;
+        return ( m == 2 && is_leap_year(y) ) ? 29 : days[m - 1] ;
+    }
+
+    // m in 1..12, d in 1..31
+    inline double days_from_civil( int y, int m, int d ){
+        y -= m <= 2 ;
+        int era = ( y >= 0 ? y : y - 399 ) / 400 ;
+        int yoe = y - era * 400 ;
+        int doy = ( 153 * ( m + ( m > 2 ? -3 : 9 ) ) + 2 ) / 5 + d - 1 ;
+        int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy ;
+        return static_cast<double>( era ) * 146097.0 + doe - 719468.0 ;
+    }
+
+    // the inverse, for a whole number of days z
+    inline void civil_from_days( double z, int& y, int& m, int& d ){
+        z += 719468.0 ;
+        double era = std::floor( z / 146097.0 ) ;
+        int doe = static_cast<int>( z - era * 146097.0 ) ;
+        int yoe = ( doe - doe / 1460 + doe / 36524 - doe / 146096 ) / 365 ;
+        int doy = doe - ( 365 * yoe + yoe / 4 - yoe / 100 ) ;
+        int mp = ( 5 * doy + 2 ) / 153 ;
+        d = doy - ( 153 * mp + 2 ) / 5 + 1 ;
+        m = mp < 10 ? mp + 3 : mp - 9 ;
+        y = static_cast<int>( era ) * 400 + yoe + ( m <= 2 ) ;
+    }
+
+    // 0 = Sunday, as tm_wday; 1970-01-01 was a Thursday
+    inline int weekday_from_days( double z ){
+        double w = std::fmod( z + 4.0, 7.0 ) ;
+        return static_cast<int>( w < 0 ? w + 7.0 : w ) ;
+    }
+
+    // broken down UTC time, fields numbered like what people read:
+    // month 1..12, yday 1..366, wday 0 (Sunday) .. 6
+    struct civil_time {
+        int year, month, mday, hour, min, sec, wday, yday ;
+        double frac ;       // fraction of a second in [0, 1)
+    } ;
+
+    // from seconds since the epoch, t must be finite
+    inline civil_time civil_from_seconds( double t ){
+        civil_time ct ;
+        double days = std::floor( t / 86400.0 ) ;
+        double sod = t - days * 86400.0 ;
+        int isod = static_cast<int>( sod ) ;
+        if( isod >= 86400 ){ isod = 86399 ; }     // rounding right below midnight
+        ct.frac = sod - isod ;
+        ct.hour = isod / 3600 ;
+        ct.min = ( isod / 60 ) % 60 ;
+        ct.sec = isod % 60 ;
+        civil_from_days( days, ct.year, ct.month, ct.mday ) ;
+        ct.wday = weekday_from_days( days ) ;
+        ct.yday = static_cast<int>( days - days_from_civil( ct.year, 1, 1 ) ) + 1 ;
+        return ct ;
+    }
+
+
+    // fills tm from t, whole seconds since the epoch, the way gmtime_()
+    // does: tm_year is the full year and tm_mon, tm_wday and tm_yday
+    // count from 0
+    inline void civil_to_tm( double t, struct tm& tm ){
+        civil_time ct = civil_from_seconds( t ) ;
+        tm = std::tm() ;
+        tm.tm_sec  = ct.sec ;
+        tm.tm_min  = ct.min ;
+        tm.tm_hour = ct.hour ;
+        tm.tm_mday = ct.mday ;
+        tm.tm_mon  = ct.month - 1 ;
+        tm.tm_year = ct.year ;
+        tm.tm_wday = ct.wday ;
+        tm.tm_yday = ct.yday - 1 ;
+    }
+
+    inline void civil_tm_na( struct tm& tm ){
+        tm = std::tm() ;
+        tm.tm_sec = tm.tm_min = tm.tm_hour = tm.tm_isdst = NA_INTEGER ;
+        tm.tm_mday = tm.tm_mon = tm.tm_year = tm.tm_wday = tm.tm_yday = NA_INTEGER ;
+    }
+
+    enum civil_field {
+        CIVIL_YEAR, CIVIL_MONTH, CIVIL_MDAY, CIVIL_WDAY, CIVIL_YDAY,
+        CIVIL_HOUR, CIVIL_MINUTE, CIVIL_SECOND
+    } ;
+
+    // One field for each element of x, which holds days (a Date vector)
+    // or seconds (a POSIXct vector) since the epoch, in UTC and numbered
+    // like the getters of Date and Datetime. Each element is decomposed
+    // into its own local civil_time; the workers never go through a Date
+    // or Datetime, whose cached struct tm is written on first access.
+    inline IntegerVector civil_fields( const NumericVector& x, bool days, civil_field field, int nthreads ){
+        R_xlen_t n = x.size() ;
+        IntegerVector res = no_init( n ) ;
+        const double* px = x.begin() ;
+        int* out = res.begin() ;
+        parallel_for( n, nthreads, [&]( R_xlen_t begin, R_xlen_t end ){
+            for( R_xlen_t i=begin; i<end; i++ ){
+                double v = px[i] ;
+                if( !R_FINITE(v) ){
+                    out[i] = NA_INTEGER ;
+                    continue ;
+                }
+                civil_time ct = civil_from_seconds( days ? std::floor( v ) * 86400.0 : v ) ;
+                switch( field ){
+                case CIVIL_YEAR:   out[i] = ct.year ; break ;
+                case CIVIL_MONTH:  out[i] = ct.month ; break ;
+                case CIVIL_MDAY:   out[i] = ct.mday ; break ;
+                case CIVIL_WDAY:   out[i] = ct.wday + 1 ; break ;
+                case CIVIL_YDAY:   out[i] = ct.yday ; break ;
+                case CIVIL_HOUR:   out[i] = ct.hour ; break ;
+                case CIVIL_MINUTE: out[i] = ct.min ; break ;
+                case CIVIL_SECOND: out[i] = ct.sec ; break ;
+                }
+            }
+        }, RCPP_DATETIME_GRAIN ) ;
+        return res ;
+    }
+
+} // internal
+} // Rcpp
+
+#endif
@@ -22,6 +22,8 @@
 #ifndef Rcpp__Date_Datetime_h
 #define Rcpp__Date_Datetime_h
 
+#include <Rcpp/date_datetime/civil.h>
+
 #include <Rcpp/date_datetime/Date.h>
 #include <Rcpp/date_datetime/oldDateVector.h>
 #include <Rcpp/date_datetime/newDateVector.h>
@@ -30,6 +32,8 @@
 #include <Rcpp/date_datetime/oldDatetimeVector.h>
 #include <Rcpp/date_datetime/newDatetimeVector.h>
 
+#include <Rcpp/date_datetime/parse_format.h>
+
 namespace Rcpp {
 
     // this is on by default since Rcpp 0.12.14
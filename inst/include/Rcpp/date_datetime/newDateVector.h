@@ -39,6 +39,7 @@ namespace Rcpp {
 
         newDateVector(SEXP vec) : NumericVector(vec) { setClass(); }
         newDateVector(int n) : NumericVector(n) { setClass(); }
+        newDateVector(const newDateVector &other) : NumericVector(other) {}
 
         inline std::vector<Date> getDates() const {
             size_t n = this->size();
@@ -48,6 +49,25 @@ namespace Rcpp {
             return v;
         }
 
+        // calendar fields of all dates at once, without making Date
+        // objects: the year, the month (1 .. 12), day of the month,
+        // weekday (1 .. 7 from Sunday) and day of the year (1 .. 366)
+        inline IntegerVector year(int nthreads = 1) const {
+            return internal::civil_fields(*this, true, internal::CIVIL_YEAR, nthreads);
+        }
+        inline IntegerVector month(int nthreads = 1) const {
+            return internal::civil_fields(*this, true, internal::CIVIL_MONTH, nthreads);
+        }
+        inline IntegerVector mday(int nthreads = 1) const {
+            return internal::civil_fields(*this, true, internal::CIVIL_MDAY, nthreads);
+        }
+        inline IntegerVector wday(int nthreads = 1) const {
+            return internal::civil_fields(*this, true, internal::CIVIL_WDAY, nthreads);
+        }
+        inline IntegerVector yday(int nthreads = 1) const {
+            return internal::civil_fields(*this, true, internal::CIVIL_YDAY, nthreads);
+        }
+
         inline newDateVector &operator=(const newDateVector &rhs) {
             if (this != &rhs) {
                 NumericVector::operator=(rhs);
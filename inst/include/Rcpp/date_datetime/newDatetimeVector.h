@@ -48,6 +48,8 @@ namespace Rcpp {
             setClass(tz);
         }
 
+        newDatetimeVector(const newDatetimeVector &other) : NumericVector(other) {}
+
         inline std::vector<Datetime> getDatetimes() const {
             size_t n = this->size();
             std::vector<Datetime> v(n);
@@ -56,6 +58,33 @@ namespace Rcpp {
             return v;
         }
 
+        // calendar and clock fields of all datetimes at once, in UTC as
+        // for Datetime and numbered like its getters
+        inline IntegerVector year(int nthreads = 1) const {
+            return internal::civil_fields(*this, false, internal::CIVIL_YEAR, nthreads);
+        }
+        inline IntegerVector month(int nthreads = 1) const {
+            return internal::civil_fields(*this, false, internal::CIVIL_MONTH, nthreads);
+        }
+        inline IntegerVector mday(int nthreads = 1) const {
+            return internal::civil_fields(*this, false, internal::CIVIL_MDAY, nthreads);
+        }
+        inline IntegerVector wday(int nthreads = 1) const {
+            return internal::civil_fields(*this, false, internal::CIVIL_WDAY, nthreads);
+        }
+        inline IntegerVector yday(int nthreads = 1) const {
+            return internal::civil_fields(*this, false, internal::CIVIL_YDAY, nthreads);
+        }
+        inline IntegerVector hour(int nthreads = 1) const {
+            return internal::civil_fields(*this, false, internal::CIVIL_HOUR, nthreads);
+        }
+        inline IntegerVector minute(int nthreads = 1) const {
+            return internal::civil_fields(*this, false, internal::CIVIL_MINUTE, nthreads);
+        }
+        inline IntegerVector second(int nthreads = 1) const {
+            return internal::civil_fields(*this, false, internal::CIVIL_SECOND, nthreads);
+        }
+
         inline newDatetimeVector &operator=(const newDatetimeVector &rhs) {
             if (this != &rhs) {
                 NumericVector::operator=(rhs);
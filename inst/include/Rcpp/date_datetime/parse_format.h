@@ -0,0 +1,457 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// parse_format.h: Rcpp R/C++ interface class library -- vectorised parsing
+//                 and formatting of dates and datetimes
+//
+// Copyright (C) 2026  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp__date_datetime__parse_format_h
+#define Rcpp__date_datetime__parse_format_h
+
+#include <cstdio>
+#include <cmath>
+
+namespace Rcpp {
+namespace internal {
+
+    static const char* const datetime_month_names[12] = {
+        "January", "February", "March", "April", "May", "June", "July",
+        "August", "September", "October", "November", "December"
+    } ;
+    static const char* const datetime_day_names[7] = {
+        "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"
+    } ;
+
+    // --- parsing
+
+    struct parsed_time {
+        parsed_time() : year(1970), month(1), mday(1), yday(0), hour(0), min(0), sec(0),
+            frac(0.0), offset(0), pm(-1) {}
+        int year, month, mday, yday, hour, min, sec ;
+        double frac ;
+        int offset ;        // seconds east of UTC, from %z
+        int pm ;            // -1 no %p, 0 AM, 1 PM
+    } ;
+
+    inline bool datetime_is_space( char c ){
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v' ;
+    }
+
+    // reads between 1 and 'width' digits
+    inline bool datetime_read_int( const char*& s, int width, int& out ){
+        int value = 0, k = 0 ;
+        while( k < width && *s >= '0' && *s <= '9' ){
+            value = value * 10 + ( *s++ - '0' ) ;
+            k++ ;
+        }
+        out = value ;
+        return k > 0 ;
+    }
+
+    // English names, full or abbreviated to three letters, any case
+    inline bool datetime_read_name( const char*& s, const char* const* names, int n, int& out ){
+        for( int k=0; k<n; k++ ){
+            const char* name = names[k] ;
+            size_t len = std::strlen( name ), j = 0 ;
+            while( j < len && s[j] && ( ( s[j] | 0x20 ) == ( name[j] | 0x20 ) ) ) j++ ;
+            if( j == len || j == 3 ){
+                s += j ;
+                out = k ;
+                return true ;
+            }
+        }
+        return false ;
+    }
+
+    // +hh, +hhmm, +hh:mm or Z
+    inline bool datetime_read_offset( const char*& s, int& offset ){
+        if( *s == 'Z' ){ s++ ; offset = 0 ; return true ; }
+        if( *s != '+' && *s != '-' ) return false ;
+        int sign = *s++ == '-' ? -1 : 1 ;
+        int hh = 0, mm = 0 ;
+        const char* start = s ;
+        if( !datetime_read_int( s, 2, hh ) || s - start != 2 ) return false ;
+        if( *s == ':' ) s++ ;
+        start = s ;
+        if( datetime_read_int( s, 2, mm ) && s - start != 2 ) return false ;
+        offset = sign * ( hh * 3600 + mm * 60 ) ;
+        return true ;
+    }
+
+    // seconds, with an optional fraction
+    inline bool datetime_read_seconds( const char*& s, parsed_time& pt ){
+        if( !datetime_read_int( s, 2, pt.sec ) ) return false ;
+        if( *s == '.' || *s == ',' ){
+            s++ ;
+            double scale = 0.1 ;
+            while( *s >= '0' && *s <= '9' ){
+                pt.frac += ( *s++ - '0' ) * scale ;
+                scale /= 10.0 ;
+            }
+        }
+        return true ;
+    }
+
+    // Does the format only use conversions parse_datetime() knows? Those
+    // are %Y %y %m %d %e %j %H %I %M %S %OS %OSn %p %b %h %B %a %A %z
+    // %F %T %R %D %n %t %%.
+    inline bool datetime_parse_format_ok( const char* fmt ){
+        for( ; *fmt; fmt++ ){
+            if( *fmt != '%' ) continue ;
+            fmt++ ;
+            if( *fmt == 'O' && fmt[1] == 'S' ){
+                fmt++ ;
+                if( fmt[1] >= '0' && fmt[1] <= '9' ) fmt++ ;
+                continue ;
+            }
+            if( !*fmt || !std::strchr( "YymdejHIMSpbhBaAzFTRDnt%", *fmt ) ) return false ;
+        }
+        return true ;
+    }
+
+    // Does the format read a UTC offset with %z? Then the time it gives
+    // does not depend on the time zone of the session.
+    inline bool datetime_format_has_offset( const char* fmt ){
+        for( ; *fmt; fmt++ ){
+            if( *fmt != '%' ) continue ;
+            fmt++ ;
+            if( *fmt == 'z' ) return true ;
+            if( !*fmt ) break ;
+        }
+        return false ;
+    }
+
+    inline bool datetime_parse_partial( const char*& s, const char* fmt, parsed_time& pt ) ;
+
+    // Matches s against fmt, whitespace in fmt matching any amount of
+    // whitespace, and leaves s just past the matched text
+    inline bool datetime_scan( const char*& s, const char* fmt, parsed_time& pt ){
+        while( *fmt ){
+            if( datetime_is_space( *fmt ) ){
+                while( datetime_is_space( *s ) ) s++ ;
+                fmt++ ;
+                continue ;
+            }
+            if( *fmt != '%' ){
+                if( *s++ != *fmt++ ) return false ;
+                continue ;
+            }
+            fmt++ ;
+            // numbers may be preceded by blanks, as with strptime
+            if( std::strchr( "YymdejHIMSO", *fmt ) ) while( *s == ' ' ) s++ ;
+            int value ;
+            bool ok = true ;
+            switch( *fmt ){
+            case 'Y': {
+                int sign = 1 ;
+                if( *s == '-' ){ sign = -1 ; s++ ; }
+                ok = datetime_read_int( s, 4, value ) ;
+                pt.year = sign * value ;
+                break ;
+            }
+            case 'y':
+                ok = datetime_read_int( s, 2, value ) ;
+                pt.year = value < 69 ? 2000 + value : 1900 + value ;
+                break ;
+            case 'm': ok = datetime_read_int( s, 2, pt.month ) && pt.month >= 1 && pt.month <= 12 ; break ;
+            case 'd':
+            case 'e': ok = datetime_read_int( s, 2, pt.mday ) && pt.mday >= 1 && pt.mday <= 31 ; break ;
+            case 'j': ok = datetime_read_int( s, 3, pt.yday ) && pt.yday >= 1 && pt.yday <= 366 ; break ;
+            case 'H': ok = datetime_read_int( s, 2, pt.hour ) && pt.hour <= 24 ; break ;
+            case 'I': ok = datetime_read_int( s, 2, pt.hour ) && pt.hour >= 1 && pt.hour <= 12 ; break ;
+            case 'M': ok = datetime_read_int( s, 2, pt.min ) && pt.min <= 59 ; break ;
+            case 'S': ok = datetime_read_int( s, 2, pt.sec ) && pt.sec <= 61 ; break ;
+            case 'O':
+                fmt++ ;    // 'S'
+                if( fmt[1] >= '0' && fmt[1] <= '9' ) fmt++ ;
+                ok = datetime_read_seconds( s, pt ) && pt.sec <= 61 ;
+                break ;
+            case 'p':
+                if( ( s[0] | 0x20 ) == 'a' && ( s[1] | 0x20 ) == 'm' ) pt.pm = 0 ;
+                else if( ( s[0] | 0x20 ) == 'p' && ( s[1] | 0x20 ) == 'm' ) pt.pm = 1 ;
+                else ok = false ;
+                s += 2 ;
+                break ;
+            case 'b':
+            case 'h':
+            case 'B':
+                ok = datetime_read_name( s, datetime_month_names, 12, value ) ;
+                pt.month = value + 1 ;
+                break ;
+            case 'a':
+            case 'A':
+                ok = datetime_read_name( s, datetime_day_names, 7, value ) ;
+                break ;
+            case 'z': ok = datetime_read_offset( s, pt.offset ) ; break ;
+            case 'F': ok = datetime_parse_partial( s, "%Y-%m-%d", pt ) ; break ;
+            case 'T': ok = datetime_parse_partial( s, "%H:%M:%S", pt ) ; break ;
+            case 'R': ok = datetime_parse_partial( s, "%H:%M", pt ) ; break ;
+            case 'D': ok = datetime_parse_partial( s, "%m/%d/%y", pt ) ; break ;
+            case 'n':
+            case 't': while( datetime_is_space( *s ) ) s++ ; break ;
+            case '%': ok = *s++ == '%' ; break ;
+            default: ok = false ;
+            }
+            if( !ok ) return false ;
+            fmt++ ;
+        }
+        return true ;
+    }
+
+    // Matches s against fmt and like strptime() ignores whatever follows.
+    // An empty fmt reads ISO 8601: YYYY-MM-DD, optionally followed by 'T'
+    // or a space and hh:mm[:ss[.fff]], optionally followed by Z or an
+    // offset, and nothing else.
+    inline bool datetime_parse( const char* s, const char* fmt, parsed_time& pt ){
+        if( *fmt ) return datetime_scan( s, fmt, pt ) ;
+        if( !datetime_scan( s, "%Y-%m-%d", pt ) ) return false ;
+        if( !*s ) return true ;
+        if( *s != 'T' && *s != ' ' ) return false ;
+        s++ ;
+        if( !datetime_read_int( s, 2, pt.hour ) || *s++ != ':' ) return false ;
+        if( !datetime_read_int( s, 2, pt.min ) ) return false ;
+        if( *s == ':' ){
+            s++ ;
+            if( !datetime_read_seconds( s, pt ) ) return false ;
+        }
+        if( *s ) return datetime_read_offset( s, pt.offset ) && !*s ;
+        return true ;
+    }
+
+    // parses a prefix of s and advances it, for the composite conversions
+    inline bool datetime_parse_partial( const char*& s, const char* fmt, parsed_time& pt ){
+        // all the composites have a fixed number of fields, each of which
+        // ends at the first character that cannot continue it
+        const char* end = s ;
+        int fields = 0 ;
+        for( const char* f=fmt; *f; f++ ) if( *f == '%' ) fields++ ;
+        for( int k=0; k<fields && *end; k++ ){
+            while( *end == ' ' ) end++ ;
+            if( *end == '-' && k == 0 ) end++ ;
+            while( *end >= '0' && *end <= '9' ) end++ ;
+            if( k + 1 < fields && *end ) end++ ;     // separator
+        }
+        std::string piece( s, end ) ;
+        if( !datetime_parse( piece.c_str(), fmt, pt ) ) return false ;
+        s = end ;
+        return true ;
+    }
+
+    // seconds since the epoch, NA_REAL for dates that do not exist
+    inline double datetime_seconds( const parsed_time& pt ){
+        int month = pt.month, mday = pt.mday, hour = pt.hour ;
+        if( pt.yday ){
+            int leap = is_leap_year( pt.year ) ;
+            if( pt.yday > 365 + leap ) return NA_REAL ;
+            int left = pt.yday ;
+            for( month=1; left > days_in_month( pt.year, month ); month++ ){
+                left -= days_in_month( pt.year, month ) ;
+            }
+            mday = left ;
+        }
+        if( mday > days_in_month( pt.year, month ) ) return NA_REAL ;
+        if( pt.pm >= 0 ) hour = ( hour % 12 ) + 12 * pt.pm ;
+        double days = days_from_civil( pt.year, month, mday ) ;
+        return days * 86400.0 + hour * 3600.0 + pt.min * 60.0 + pt.sec + pt.frac - pt.offset ;
+    }
+
+    // --- formatting
+
+    inline void datetime_put_int( std::string& out, int value, int width, char pad = '0' ){
+        char tmp[16] ;
+        int n = snprintf( tmp, sizeof(tmp), pad == '0' ? "%0*d" : "%*d", width, value ) ;
+        out.append( tmp, n ) ;
+    }
+
+    // Does the format only use conversions format_datetime() knows? Those
+    // are %Y %y %C %m %d %e %j %H %I %M %S %OS %OSn %p %b %h %B %a %A %u
+    // %w %F %T %R %D %z %Z %s %n %t %%.
+    inline bool datetime_format_format_ok( const char* fmt ){
+        for( ; *fmt; fmt++ ){
+            if( *fmt != '%' ) continue ;
+            fmt++ ;
+            if( *fmt == 'O' && fmt[1] == 'S' ){
+                fmt++ ;
+                if( fmt[1] >= '0' && fmt[1] <= '9' ) fmt++ ;
+                continue ;
+            }
+            if( !*fmt || !std::strchr( "YyCmdejHIMSpbhBaAuwFTRDzZsnt%", *fmt ) ) return false ;
+        }
+        return true ;
+    }
+
+    // appends t (seconds since the epoch, finite) formatted as fmt, in UTC
+    inline void datetime_format( std::string& out, double t, const char* fmt ){
+        civil_time ct = civil_from_seconds( t ) ;
+        for( ; *fmt; fmt++ ){
+            if( *fmt != '%' ){
+                out.push_back( *fmt ) ;
+                continue ;
+            }
+            fmt++ ;
+            switch( *fmt ){
+            case 'Y':
+                if( ct.year < 0 ){ out.push_back( '-' ) ; datetime_put_int( out, -ct.year, 4 ) ; }
+                else datetime_put_int( out, ct.year, 4 ) ;
+                break ;
+            case 'y': datetime_put_int( out, ( ( ct.year % 100 ) + 100 ) % 100, 2 ) ; break ;
+            case 'C': datetime_put_int( out, ct.year / 100, 2 ) ; break ;
+            case 'm': datetime_put_int( out, ct.month, 2 ) ; break ;
+            case 'd': datetime_put_int( out, ct.mday, 2 ) ; break ;
+            case 'e': datetime_put_int( out, ct.mday, 2, ' ' ) ; break ;
+            case 'j': datetime_put_int( out, ct.yday, 3 ) ; break ;
+            case 'H': datetime_put_int( out, ct.hour, 2 ) ; break ;
+            case 'I': datetime_put_int( out, ct.hour % 12 == 0 ? 12 : ct.hour % 12, 2 ) ; break ;
+            case 'M': datetime_put_int( out, ct.min, 2 ) ; break ;
+            case 'S': datetime_put_int( out, ct.sec, 2 ) ; break ;
+            case 'O': {
+                fmt++ ;    // 'S'
+                int digits = 0 ;
+                if( fmt[1] >= '0' && fmt[1] <= '9' ) digits = *++fmt - '0' ;
+                datetime_put_int( out, ct.sec, 2 ) ;
+                if( digits > 0 ){
+                    // rounded to the microsecond first so that 0.123 stored
+                    // as 0.12299999... still shows as .123, then truncated
+                    double us = std::floor( ct.frac * 1e6 + 0.5 ) ;
+                    if( us > 999999.0 ) us = 999999.0 ;
+                    char tmp[8] ;
+                    snprintf( tmp, sizeof(tmp), "%06d", static_cast<int>(us) ) ;
+                    out.push_back( '.' ) ;
+                    out.append( tmp, digits > 6 ? 6 : digits ) ;
+                }
+                break ;
+            }
+            case 'p': out.append( ct.hour < 12 ? "AM" : "PM" ) ; break ;
+            case 'b':
+            case 'h': out.append( datetime_month_names[ ct.month - 1 ], 3 ) ; break ;
+            case 'B': out.append( datetime_month_names[ ct.month - 1 ] ) ; break ;
+            case 'a': out.append( datetime_day_names[ ct.wday ], 3 ) ; break ;
+            case 'A': out.append( datetime_day_names[ ct.wday ] ) ; break ;
+            case 'u': datetime_put_int( out, ct.wday == 0 ? 7 : ct.wday, 1 ) ; break ;
+            case 'w': datetime_put_int( out, ct.wday, 1 ) ; break ;
+            case 'F': datetime_format( out, t, "%Y-%m-%d" ) ; break ;
+            case 'T': datetime_format( out, t, "%H:%M:%S" ) ; break ;
+            case 'R': datetime_format( out, t, "%H:%M" ) ; break ;
+            case 'D': datetime_format( out, t, "%m/%d/%y" ) ; break ;
+            case 'z': out.append( "+0000" ) ; break ;
+            case 'Z': out.append( "UTC" ) ; break ;
+            case 's': {
+                char tmp[32] ;
+                int n = snprintf( tmp, sizeof(tmp), "%.0f", std::floor(t) ) ;
+                out.append( tmp, n ) ;
+                break ;
+            }
+            case 'n': out.push_back( '\n' ) ; break ;
+            case 't': out.push_back( '\t' ) ; break ;
+            case '%': out.push_back( '%' ) ; break ;
+            }
+        }
+    }
+
+    // Parses x in parallel into seconds since the epoch. The CHARSXP
+    // contents are fetched up front so the workers never call into R.
+    inline void datetime_parse_vector( const CharacterVector& x, const std::string& fmt, int nthreads, double* out ){
+        if( !datetime_parse_format_ok( fmt.c_str() ) ){
+            stop( "unsupported conversion in format '%s'", fmt ) ;
+        }
+        R_xlen_t n = x.size() ;
+        std::vector<const char*> s( n ) ;
+        for( R_xlen_t i=0; i<n; i++ ){
+            SEXP elt = STRING_ELT( x, i ) ;
+            s[i] = elt == NA_STRING ? static_cast<const char*>(0) : CHAR( elt ) ;
+        }
+        const char* f = fmt.c_str() ;
+        parallel_for( n, nthreads, [&]( R_xlen_t begin, R_xlen_t end ){
+            for( R_xlen_t i=begin; i<end; i++ ){
+                parsed_time pt ;
+                out[i] = ( s[i] && datetime_parse( s[i], f, pt ) ) ? datetime_seconds( pt ) : NA_REAL ;
+            }
+        }, RCPP_DATETIME_GRAIN ) ;
+    }
+
+    // Formats the n seconds since the epoch at t in parallel, each thread
+    // writing to its own buffer; the CHARSXPs are made afterwards on the
+    // calling thread. Non finite values give NA.
+    inline CharacterVector datetime_format_vector( const double* t, R_xlen_t n, double scale, const std::string& fmt, int nthreads ){
+        if( !datetime_format_format_ok( fmt.c_str() ) ){
+            stop( "unsupported conversion in format '%s'", fmt ) ;
+        }
+        const char* f = fmt.c_str() ;
+        std::vector<R_xlen_t> bounds = parallel_bounds( n, nthreads, RCPP_DATETIME_GRAIN ) ;
+        std::vector<std::string> buffers( bounds.size() - 1 ) ;
+        std::vector<size_t> ends( n ) ;
+        parallel_ranges( bounds, [&]( R_xlen_t begin, R_xlen_t end ){
+            size_t k = std::lower_bound( bounds.begin(), bounds.end(), begin ) - bounds.begin() ;
+            std::string& buffer = buffers[k] ;
+            for( R_xlen_t i=begin; i<end; i++ ){
+                if( R_FINITE( t[i] ) ) datetime_format( buffer, t[i] * scale, f ) ;
+                ends[i] = buffer.size() ;
+            }
+        }) ;
+        CharacterVector res( n ) ;
+        for( size_t k=0; k+1<bounds.size(); k++ ){
+            size_t start = 0 ;
+            for( R_xlen_t i=bounds[k]; i<bounds[k+1]; i++ ){
+                if( R_FINITE( t[i] ) ){
+                    SET_STRING_ELT( res, i, Rf_mkCharLenCE( buffers[k].data() + start, static_cast<int>( ends[i] - start ), CE_UTF8 ) ) ;
+                } else {
+                    SET_STRING_ELT( res, i, NA_STRING ) ;
+                }
+                start = ends[i] ;
+            }
+        }
+        return res ;
+    }
+
+} // internal
+
+    // Dates read from x with a strptime() style format; strings that do
+    // not match, or name a day that does not exist, give NA
+    inline newDateVector parse_date( const CharacterVector& x, const std::string& fmt = "%Y-%m-%d", int nthreads = 1 ){
+        Shield<SEXP> days( Rf_allocVector( REALSXP, x.size() ) ) ;
+        newDateVector res( days ) ;
+        double* out = res.begin() ;
+        internal::datetime_parse_vector( x, fmt, nthreads, out ) ;
+        for( R_xlen_t i=0; i<res.size(); i++ ) out[i] = std::floor( out[i] / 86400.0 ) ;
+        return res ;
+    }
+
+    // Datetimes read from x, as UTC unless the string carries an offset
+    // (%z, or Z / +hh:mm in ISO 8601). The default, empty, format reads
+    // ISO 8601 such as 2026-10-19, 2026-10-19 12:30 or
+    // 2026-10-19T12:30:15.250+02:00.
+    inline newDatetimeVector parse_datetime( const CharacterVector& x, const std::string& fmt = "", int nthreads = 1 ){
+        Shield<SEXP> times( Rf_allocVector( REALSXP, x.size() ) ) ;
+        newDatetimeVector res( times, "UTC" ) ;
+        internal::datetime_parse_vector( x, fmt, nthreads, res.begin() ) ;
+        return res ;
+    }
+
+    // strftime() style formatting, without locales or time zones: names
+    // are English and datetimes are shown in UTC
+    inline CharacterVector format_date( const NumericVector& x, const std::string& fmt = "%Y-%m-%d", int nthreads = 1 ){
+        return internal::datetime_format_vector( x.begin(), x.size(), 86400.0, fmt, nthreads ) ;
+    }
+
+    inline CharacterVector format_datetime( const NumericVector& x, const std::string& fmt = "%Y-%m-%d %H:%M:%S", int nthreads = 1 ){
+        return internal::datetime_format_vector( x.begin(), x.size(), 1.0, fmt, nthreads ) ;
+    }
+
+} // Rcpp
+
+#endif
@@ -0,0 +1,367 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// PartitionedHash.h: Rcpp R/C++ interface class library -- hashing for
+//                    long vectors, optionally split by hash across threads
+//
+// Copyright (C) 2026  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef RCPP__HASH__PARTITIONED_HASH_H
+#define RCPP__HASH__PARTITIONED_HASH_H
+
+#include <cstring>
+#include <limits>
+
+// minimum number of elements per thread before the input is split
+#ifndef RCPP_HASH_GRAIN
+#define RCPP_HASH_GRAIN 65536
+#endif
+
+namespace Rcpp{
+namespace sugar{
+namespace hash_detail{
+
+    // 64 bit finalizer of MurmurHash3, all bits of the input affect
+    // both the low bits (slot) and the high bits (partition)
+    inline uint64_t mix( uint64_t h ){
+        h ^= h >> 33 ;
+        h *= 0xff51afd7ed558ccdULL ;
+        h ^= h >> 33 ;
+        h *= 0xc4ceb9fe1a85ec53ULL ;
+        h ^= h >> 33 ;
+        return h ;
+    }
+
+    inline uint64_t bits( double x ){
+        uint64_t u ;
+        std::memcpy( &u, &x, sizeof(double) ) ;
+        return u ;
+    }
+
+    // values that R considers the same are mapped to the same bits:
+    // 0.0 and -0.0, and all the NA (resp. NaN) payloads
+    inline int normalize( int x ){ return x ; }
+    inline uint64_t normalize( uint64_t x ){ return x ; }
+    inline SEXP normalize( SEXP x ){ return x ; }
+    inline double normalize( double x ){
+        if( x == 0.0 ) return 0.0 ;
+        if( internal::Rcpp_IsNA(x) ) return NA_REAL ;
+        if( internal::Rcpp_IsNaN(x) ) return R_NaN ;
+        return x ;
+    }
+    inline Rcomplex normalize( Rcomplex x ){
+        x.r = normalize( x.r ) ;
+        x.i = normalize( x.i ) ;
+        return x ;
+    }
+
+    inline uint64_t hash( int x ){ return mix( static_cast<uint32_t>(x) ) ; }
+    inline uint64_t hash( uint64_t x ){ return mix( x ) ; }
+    inline uint64_t hash( double x ){ return mix( bits(x) ) ; }
+    inline uint64_t hash( SEXP x ){ return mix( static_cast<uint64_t>( reinterpret_cast<uintptr_t>(x) ) ) ; }
+    inline uint64_t hash( Rcomplex x ){ return mix( bits(x.r) ^ mix( bits(x.i) ) ) ; }
+
+    // both arguments already normalized
+    inline bool equal( int x, int y ){ return x == y ; }
+    inline bool equal( uint64_t x, uint64_t y ){ return x == y ; }
+    inline bool equal( SEXP x, SEXP y ){ return x == y ; }
+    inline bool equal( double x, double y ){ return bits(x) == bits(y) ; }
+    inline bool equal( Rcomplex x, Rcomplex y ){ return bits(x.r) == bits(y.r) && bits(x.i) == bits(y.i) ; }
+
+    // Open addressing table of positions into src, linear probing. A
+    // slot holds position + 1, 0 is empty. INDEX is uint32_t unless the
+    // source has more than 2^32 - 2 elements. The table owns its slots,
+    // nothing is shared between calls or threads.
+    template <typename STORAGE, typename INDEX>
+    class FlatIndexTable {
+    public:
+        FlatIndexTable() : src(0), slots(), mask(0) {}
+
+        FlatIndexTable( const STORAGE* src_, R_xlen_t expected ) : src(src_), slots(), mask(0) {
+            reserve( expected ) ;
+        }
+
+        void reset( const STORAGE* src_, R_xlen_t expected ){
+            src = src_ ;
+            reserve( expected ) ;
+        }
+
+        // position of the first element equal to src[i] seen so far,
+        // i itself when src[i] was not in the table yet
+        inline R_xlen_t insert( R_xlen_t i, STORAGE value, uint64_t h ){
+            uint64_t addr = h & mask ;
+            while( slots[addr] ){
+                R_xlen_t j = static_cast<R_xlen_t>( slots[addr] ) - 1 ;
+                if( equal( normalize( src[j] ), value ) ) return j ;
+                addr = ( addr + 1 ) & mask ;
+            }
+            slots[addr] = static_cast<INDEX>( i + 1 ) ;
+            return i ;
+        }
+
+        // position of the first element equal to value, -1 if absent
+        inline R_xlen_t find( STORAGE value, uint64_t h ) const {
+            uint64_t addr = h & mask ;
+            while( slots[addr] ){
+                R_xlen_t j = static_cast<R_xlen_t>( slots[addr] ) - 1 ;
+                if( equal( normalize( src[j] ), value ) ) return j ;
+                addr = ( addr + 1 ) & mask ;
+            }
+            return -1 ;
+        }
+
+    private:
+        void reserve( R_xlen_t expected ){
+            uint64_t m = 2 ;
+            while( m < static_cast<uint64_t>( expected ) * 2 ) m *= 2 ;
+            slots.assign( m, 0 ) ;
+            mask = m - 1 ;
+        }
+
+        const STORAGE* src ;
+        std::vector<INDEX> slots ;
+        uint64_t mask ;
+    } ;
+
+} // hash_detail
+
+    // Hashes the n elements at src. With one thread a single table is
+    // used. With more threads the elements are first split on the high
+    // bits of their hash into partitions that are independent: equal
+    // values always land in the same one, and each partition keeps the
+    // original order of its elements, so the first occurrence of a value
+    // is the same as with a single table. Partitions are then hashed
+    // concurrently. src must stay valid and unchanged while this lives;
+    // the worker threads only ever read it.
+    template <typename STORAGE, typename INDEX>
+    class PartitionedHash {
+    public:
+        typedef hash_detail::FlatIndexTable<STORAGE,INDEX> TABLE ;
+
+        PartitionedHash( const STORAGE* src_, R_xlen_t n_, int nthreads_ = 1 ) :
+            src(src_), n(n_), nthreads( internal::parallel_threads( n_, nthreads_, RCPP_HASH_GRAIN ) ),
+            shift(64), tables(), hashes(), positions(), starts()
+        {}
+
+        // Calls visit( i, first ) for every i, where first is the position
+        // of the first element equal to src[i]. Calls for one partition are
+        // made in increasing i from a single thread, different partitions
+        // may run at the same time.
+        template <typename Visitor>
+        void fill( Visitor& visit ){
+            if( nthreads == 1 ){
+                tables.resize(1) ;
+                tables[0].reset( src, n ) ;
+                TABLE& table = tables[0] ;
+                for( R_xlen_t i=0; i<n; i++ ){
+                    STORAGE value = hash_detail::normalize( src[i] ) ;
+                    visit( i, table.insert( i, value, hash_detail::hash( value ) ) ) ;
+                }
+                return ;
+            }
+            partition() ;
+            std::vector<R_xlen_t> bounds = partition_bounds() ;
+            internal::parallel_ranges( bounds, [&]( R_xlen_t first, R_xlen_t last ){
+                for( R_xlen_t p=first; p<last; p++ ){
+                    TABLE& table = tables[p] ;
+                    table.reset( src, starts[p+1] - starts[p] ) ;
+                    for( R_xlen_t k=starts[p]; k<starts[p+1]; k++ ){
+                        R_xlen_t i = static_cast<R_xlen_t>( positions[k] ) ;
+                        visit( i, table.insert( i, hash_detail::normalize( src[i] ), hashes[i] ) ) ;
+                    }
+                }
+            }) ;
+            // only needed while filling
+            std::vector<uint64_t>().swap( hashes ) ;
+            std::vector<INDEX>().swap( positions ) ;
+        }
+
+        // position of the first element equal to value, -1 if absent.
+        // Only valid after fill(), safe to call from several threads.
+        inline R_xlen_t find( STORAGE value ) const {
+            value = hash_detail::normalize( value ) ;
+            uint64_t h = hash_detail::hash( value ) ;
+            return tables[ shift == 64 ? 0 : h >> shift ].find( value, h ) ;
+        }
+
+        inline int threads() const { return nthreads ; }
+
+    private:
+
+        // stable counting sort of the positions by partition
+        void partition(){
+            int bits = 0 ;
+            while( ( 1 << bits ) < 4 * nthreads ) bits++ ;
+            R_xlen_t np = static_cast<R_xlen_t>(1) << bits ;
+            shift = 64 - bits ;
+            tables.resize( np ) ;
+            hashes.resize( n ) ;
+            positions.resize( n ) ;
+
+            std::vector<R_xlen_t> bounds( nthreads + 1 ) ;
+            for( int t=0; t<=nthreads; t++ ){
+                bounds[t] = static_cast<R_xlen_t>( static_cast<double>(n) * t / nthreads ) ;
+            }
+            bounds[nthreads] = n ;
+            std::vector<R_xlen_t> counts( nthreads * np, 0 ) ;
+            internal::parallel_ranges( bounds, [&]( R_xlen_t begin, R_xlen_t end ){
+                size_t t = std::lower_bound( bounds.begin(), bounds.end(), begin ) - bounds.begin() ;
+                R_xlen_t* cnt = &counts[ t * np ] ;
+                for( R_xlen_t i=begin; i<end; i++ ){
+                    uint64_t h = hash_detail::hash( hash_detail::normalize( src[i] ) ) ;
+                    hashes[i] = h ;
+                    cnt[ h >> shift ]++ ;
+                }
+            }) ;
+            starts.assign( np + 1, 0 ) ;
+            std::vector<R_xlen_t> offsets( nthreads * np ) ;
+            R_xlen_t running = 0 ;
+            for( R_xlen_t p=0; p<np; p++ ){
+                starts[p] = running ;
+                for( int t=0; t<nthreads; t++ ){
+                    offsets[ t * np + p ] = running ;
+                    running += counts[ t * np + p ] ;
+                }
+            }
+            starts[np] = n ;
+            internal::parallel_ranges( bounds, [&]( R_xlen_t begin, R_xlen_t end ){
+                size_t t = std::lower_bound( bounds.begin(), bounds.end(), begin ) - bounds.begin() ;
+                R_xlen_t* off = &offsets[ t * np ] ;
+                for( R_xlen_t i=begin; i<end; i++ ){
+                    positions[ off[ hashes[i] >> shift ]++ ] = static_cast<INDEX>(i) ;
+                }
+            }) ;
+        }
+
+        // groups of consecutive partitions holding similar numbers of elements
+        std::vector<R_xlen_t> partition_bounds() const {
+            R_xlen_t np = static_cast<R_xlen_t>( tables.size() ) ;
+            std::vector<R_xlen_t> bounds( 1, 0 ) ;
+            R_xlen_t target = n / nthreads ;
+            for( R_xlen_t p=1; p<np; p++ ){
+                if( starts[p] - starts[ bounds.back() ] >= target && static_cast<int>( bounds.size() ) < nthreads ){
+                    bounds.push_back( p ) ;
+                }
+            }
+            bounds.push_back( np ) ;
+            return bounds ;
+        }
+
+        const STORAGE* src ;
+        R_xlen_t n ;
+        int nthreads ;
+        int shift ;
+        std::vector<TABLE> tables ;
+        std::vector<uint64_t> hashes ;
+        std::vector<INDEX> positions ;
+        std::vector<R_xlen_t> starts ;
+    } ;
+
+namespace hash_detail{
+
+    // calls fun.template run<INDEX>() with the narrowest index type
+    // able to hold n positions
+    template <typename Fun>
+    inline void dispatch_index( R_xlen_t n, Fun& fun ){
+        if( static_cast<uint64_t>(n) < 0xFFFFFFFFULL ){
+            fun.template run<uint32_t>() ;
+        } else {
+            fun.template run<uint64_t>() ;
+        }
+    }
+
+    struct FirstFlags {
+        FirstFlags( unsigned char* flags_ ) : flags(flags_){}
+        inline void operator()( R_xlen_t i, R_xlen_t first ){ flags[i] = ( first == i ) ; }
+        unsigned char* flags ;
+    } ;
+
+    template <typename INDEX>
+    struct FirstPositions {
+        FirstPositions( INDEX* first_ ) : first(first_){}
+        inline void operator()( R_xlen_t i, R_xlen_t f ){ first[i] = static_cast<INDEX>(f) ; }
+        INDEX* first ;
+    } ;
+
+    // flags[i] = 1 when src[i] is the first of its value
+    template <typename STORAGE>
+    struct first_flags {
+        first_flags( const STORAGE* src_, R_xlen_t n_, int nthreads_, unsigned char* flags_ ) :
+            src(src_), n(n_), nthreads(nthreads_), flags(flags_){}
+        template <typename INDEX> void run(){
+            PartitionedHash<STORAGE,INDEX> hash( src, n, nthreads ) ;
+            FirstFlags visit( flags ) ;
+            hash.fill( visit ) ;
+        }
+        const STORAGE* src ; R_xlen_t n ; int nthreads ; unsigned char* flags ;
+    } ;
+
+    // out[i] = 1 based rank of the first appearance of src[i]'s value
+    template <typename STORAGE, typename OUT>
+    struct self_match_ids {
+        self_match_ids( const STORAGE* src_, R_xlen_t n_, int nthreads_, OUT* out_ ) :
+            src(src_), n(n_), nthreads(nthreads_), out(out_), groups(0){}
+        template <typename INDEX> void run(){
+            std::vector<INDEX> first( n ) ;
+            {
+                PartitionedHash<STORAGE,INDEX> hash( src, n, nthreads ) ;
+                FirstPositions<INDEX> visit( n ? &first[0] : static_cast<INDEX*>(0) ) ;
+                hash.fill( visit ) ;
+            }
+            // first[i] <= i, so the id of first[i] is known by the time
+            // it is needed; ids are kept in the first array itself
+            for( R_xlen_t i=0; i<n; i++ ){
+                R_xlen_t f = static_cast<R_xlen_t>( first[i] ) ;
+                if( f == i ){
+                    if( static_cast<double>( ++groups ) > static_cast<double>( std::numeric_limits<OUT>::max() ) ){
+                        stop( "too many distinct values for an integer result, use self_match_long()" ) ;
+                    }
+                    out[i] = static_cast<OUT>( groups ) ;
+                } else {
+                    out[i] = out[f] ;
+                }
+            }
+        }
+        const STORAGE* src ; R_xlen_t n ; int nthreads ; OUT* out ; R_xlen_t groups ;
+    } ;
+
+    // out[i] = 1 based position of x[i] in table, NA when absent
+    template <typename STORAGE, typename OUT>
+    struct match_positions {
+        match_positions( const STORAGE* x_, R_xlen_t nx_, const STORAGE* table_, R_xlen_t nt_, int nthreads_, OUT* out_, OUT na_ ) :
+            x(x_), nx(nx_), table(table_), nt(nt_), nthreads(nthreads_), out(out_), na(na_){}
+        template <typename INDEX> void run(){
+            PartitionedHash<STORAGE,INDEX> hash( table, nt, nthreads ) ;
+            // keeping the tables is enough to answer lookups
+            struct Ignore { inline void operator()( R_xlen_t, R_xlen_t ){} } ignore ;
+            hash.fill( ignore ) ;
+            const PartitionedHash<STORAGE,INDEX>& h = hash ;
+            internal::parallel_for( nx, nthreads, [&]( R_xlen_t begin, R_xlen_t end ){
+                for( R_xlen_t i=begin; i<end; i++ ){
+                    R_xlen_t pos = h.find( x[i] ) ;
+                    out[i] = pos < 0 ? na : static_cast<OUT>( pos + 1 ) ;
+                }
+            }, RCPP_HASH_GRAIN ) ;
+        }
+        const STORAGE* x ; R_xlen_t nx ; const STORAGE* table ; R_xlen_t nt ; int nthreads ; OUT* out ; OUT na ;
+    } ;
+
+} // hash_detail
+} // sugar
+} // Rcpp
+
+#endif
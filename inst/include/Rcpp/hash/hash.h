@@ -26,6 +26,7 @@
 
 #include <Rcpp/hash/IndexHash.h>
 #include <Rcpp/hash/SelfHash.h>
+#include <Rcpp/hash/PartitionedHash.h>
 
 #endif
 
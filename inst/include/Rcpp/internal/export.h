@@ -22,6 +22,39 @@
 #define Rcpp__internal__export__h
 
 namespace Rcpp{
+
+    /**
+     * What converting an R vector to a container of C++ numbers does with
+     * its missing values (NA, and NaN for doubles). By default they become
+     * what coercing to the R type for T gives, cast to T: NaN for floating
+     * point types, NA_INTEGER for int, and whatever the C++ cast gives for
+     * other integer types. They can also be replaced by a value, or be an
+     * error:
+     *
+     * std::vector<float> x = as_with_na< std::vector<float> >( v, ExportNA<float>::replace(0.0f) ) ;
+     */
+    template <typename T>
+    struct ExportNA {
+        enum Action { coerce, replace_value, stop_on_na } ;
+
+        ExportNA() : action(coerce), value() {}
+
+        static ExportNA replace( T value_ ){
+            ExportNA na ;
+            na.action = replace_value ;
+            na.value = value_ ;
+            return na ;
+        }
+        static ExportNA stop(){
+            ExportNA na ;
+            na.action = stop_on_na ;
+            return na ;
+        }
+
+        Action action ;
+        T value ;
+    } ;
+
     namespace internal{
 
 
@@ -42,37 +75,113 @@ namespace Rcpp{
 			return as_string_elt__impl<T>( x, i, typename Rcpp::traits::is_wide_string<T>::type() ) ;
 		}
 
+        /* single pass conversion of numbers */
+
+        // counts the NAs a conversion introduces: only a double read into
+        // an int can give NA_INTEGER without being missing itself, when it
+        // is out of the integer range. Other pairs of types never do.
+        inline bool export_numbers__na_introduced( double from, int to, ::Rcpp::traits::true_type ){
+            return to == NA_INTEGER && ! ISNAN(from) ;
+        }
+
+        template <typename FROM_STORAGE, typename STORAGE>
+        inline bool export_numbers__na_introduced( FROM_STORAGE, STORAGE, ::Rcpp::traits::false_type ){
+            return false ;
+        }
+
+        // Converts the elements of x, a vector of type FROM, straight to
+        // value_type and hands each to sink(i, value). The result is the
+        // same as coercing x to the R type for value_type with r_cast() and
+        // casting each element, without the intermediate vector.
+        template <int FROM, typename value_type, typename Sink>
+        void export_numbers__kernel( SEXP x, Sink& sink, const ::Rcpp::ExportNA<value_type>& na ) {
+            const int RTYPE = ::Rcpp::traits::r_sexptype_traits<value_type>::rtype ;
+            typedef typename ::Rcpp::traits::storage_type<FROM>::type FROM_STORAGE ;
+            typedef typename ::Rcpp::traits::storage_type<RTYPE>::type STORAGE ;
+            typedef typename ::Rcpp::traits::integral_constant<bool, FROM == REALSXP && RTYPE == INTSXP>::type can_introduce_na ;
+            const FROM_STORAGE* start = ::Rcpp::internal::r_vector_start<FROM>(x) ;
+            R_xlen_t n = ::Rf_xlength(x) ;
+            R_xlen_t introduced = 0 ;
+            for( R_xlen_t i=0; i<n; i++ ){
+                FROM_STORAGE from = start[i] ;
+                if( na.action != ::Rcpp::ExportNA<value_type>::coerce && ::Rcpp::traits::is_na<FROM>(from) ){
+                    if( na.action == ::Rcpp::ExportNA<value_type>::stop_on_na ){
+                        throw ::Rcpp::not_compatible( "Missing value at position %d.", i + 1 ) ;
+                    }
+                    sink( i, na.value ) ;
+                    continue ;
+                }
+                STORAGE to = r_coerce<FROM,RTYPE>( from ) ;
+                if( export_numbers__na_introduced( from, to, can_introduce_na() ) ) introduced++ ;
+                sink( i, caster<STORAGE,value_type>( to ) ) ;
+            }
+            if( introduced ) ::Rf_warning( "NAs introduced by coercion to integer range" ) ;
+        }
+
+        // logical, integer and double targets read logical, integer, double
+        // and raw vectors directly; everything else goes through r_cast()
+        template <typename value_type, typename Sink>
+        void export_numbers__dispatch( SEXP x, Sink& sink, const ::Rcpp::ExportNA<value_type>& na, ::Rcpp::traits::false_type ) {
+            const int RTYPE = ::Rcpp::traits::r_sexptype_traits<value_type>::rtype ;
+            Shield<SEXP> y( ::Rcpp::r_cast<RTYPE>(x) ) ;
+            export_numbers__kernel<RTYPE,value_type>( y, sink, na ) ;
+        }
+
+        template <typename value_type, typename Sink>
+        void export_numbers__dispatch( SEXP x, Sink& sink, const ::Rcpp::ExportNA<value_type>& na, ::Rcpp::traits::true_type ) {
+            switch( TYPEOF(x) ){
+            case LGLSXP:  export_numbers__kernel<LGLSXP,value_type>( x, sink, na ) ; return ;
+            case INTSXP:  export_numbers__kernel<INTSXP,value_type>( x, sink, na ) ; return ;
+            case REALSXP: export_numbers__kernel<REALSXP,value_type>( x, sink, na ) ; return ;
+            case RAWSXP:  export_numbers__kernel<RAWSXP,value_type>( x, sink, na ) ; return ;
+            default: break ;
+            }
+            export_numbers__dispatch<value_type>( x, sink, na, ::Rcpp::traits::false_type() ) ;
+        }
+
+        template <typename value_type, typename Sink>
+        void export_numbers( SEXP x, Sink& sink, const ::Rcpp::ExportNA<value_type>& na ) {
+            const int RTYPE = ::Rcpp::traits::r_sexptype_traits<value_type>::rtype ;
+            export_numbers__dispatch<value_type>( x, sink, na,
+                typename ::Rcpp::traits::integral_constant<bool, RTYPE == LGLSXP || RTYPE == INTSXP || RTYPE == REALSXP>::type() ) ;
+        }
+
+        template <typename InputIterator>
+        struct export_range__sink {
+            export_range__sink( InputIterator first_ ) : first(first_){}
+            template <typename U>
+            inline void operator()( R_xlen_t, const U& value ){
+                *first = value ;
+                ++first ;
+            }
+            InputIterator first ;
+        } ;
+
+        template <typename T>
+        struct export_indexing__sink {
+            export_indexing__sink( T& res_ ) : res(res_){}
+            template <typename U>
+            inline void operator()( R_xlen_t i, const U& value ){
+                res[i] = value ;
+            }
+            T& res ;
+        } ;
+
         /* iterating */
 
 		template <typename InputIterator, typename value_type>
-			void export_range__impl( SEXP x, InputIterator first, ::Rcpp::traits::false_type ) {
-			const int RTYPE = ::Rcpp::traits::r_sexptype_traits<value_type>::rtype ;
-			typedef typename ::Rcpp::traits::storage_type<RTYPE>::type STORAGE ;
-			Shield<SEXP> y( ::Rcpp::r_cast<RTYPE>(x) ) ;
-			STORAGE* start = ::Rcpp::internal::r_vector_start<RTYPE>(y) ;
-			std::copy( start, start + ::Rf_xlength(y), first ) ;
+		void export_range__impl( SEXP x, InputIterator first, const ::Rcpp::ExportNA<value_type>& na = ::Rcpp::ExportNA<value_type>() ) {
+			export_range__sink<InputIterator> sink( first ) ;
+			export_numbers<value_type>( x, sink, na ) ;
 		}
 
-		template <typename InputIterator, typename value_type>
-		void export_range__impl( SEXP x, InputIterator first, ::Rcpp::traits::true_type ) {
-			const int RTYPE = ::Rcpp::traits::r_sexptype_traits<value_type>::rtype ;
-			typedef typename ::Rcpp::traits::storage_type<RTYPE>::type STORAGE ;
-			Shield<SEXP> y( ::Rcpp::r_cast<RTYPE>(x) ) ;
-			STORAGE* start = ::Rcpp::internal::r_vector_start<RTYPE>(y) ;
-			std::transform( start, start + ::Rf_xlength(y) , first, caster<STORAGE,value_type> ) ;
-        }
-
         // implemented in meat
         template <typename InputIterator, typename value_type>
         void export_range__dispatch( SEXP x, InputIterator first, ::Rcpp::traits::r_type_generic_tag ) ;
 
         template <typename InputIterator, typename value_type>
         void export_range__dispatch( SEXP x, InputIterator first, ::Rcpp::traits::r_type_primitive_tag ) {
-			export_range__impl<InputIterator,value_type>(
-				x,
-				first,
-				typename ::Rcpp::traits::r_sexptype_needscast<value_type>()
-			);
+			export_range__impl<InputIterator,value_type>( x, first ) ;
 		}
 
 		template <typename InputIterator, typename value_type>
@@ -102,36 +211,14 @@ namespace Rcpp{
         /* indexing */
 
 		template <typename T, typename value_type>
-			void export_indexing__impl( SEXP x, T& res, ::Rcpp::traits::false_type ) {
-			const int RTYPE = ::Rcpp::traits::r_sexptype_traits<value_type>::rtype ;
-			typedef typename ::Rcpp::traits::storage_type<RTYPE>::type STORAGE ;
-			Shield<SEXP> y( ::Rcpp::r_cast<RTYPE>(x) ) ;
-			STORAGE* start = ::Rcpp::internal::r_vector_start<RTYPE>(y) ;
-			R_xlen_t size = ::Rf_xlength(y)  ;
-			for( R_xlen_t i=0; i<size; i++){
-				res[i] =  start[i] ;
-			}
-		}
-
-		template <typename T, typename value_type>
-		void export_indexing__impl( SEXP x, T& res, ::Rcpp::traits::true_type ) {
-			const int RTYPE = ::Rcpp::traits::r_sexptype_traits<value_type>::rtype ;
-			typedef typename ::Rcpp::traits::storage_type<RTYPE>::type STORAGE ;
-			Shield<SEXP> y( ::Rcpp::r_cast<RTYPE>(x) );
-			STORAGE* start = ::Rcpp::internal::r_vector_start<RTYPE>(y) ;
-			R_xlen_t size = ::Rf_xlength(y)  ;
-			for( R_xlen_t i=0; i<size; i++){
-				res[i] = caster<STORAGE,value_type>(start[i]) ;
-			}
+		void export_indexing__impl( SEXP x, T& res ) {
+			export_indexing__sink<T> sink( res ) ;
+			export_numbers<value_type>( x, sink, ::Rcpp::ExportNA<value_type>() ) ;
 		}
 
 		template <typename T, typename value_type>
 		void export_indexing__dispatch( SEXP x, T& res, ::Rcpp::traits::r_type_primitive_tag ) {
-			export_indexing__impl<T,value_type>(
-				x,
-				res,
-				typename ::Rcpp::traits::r_sexptype_needscast<value_type>()
-			);
+			export_indexing__impl<T,value_type>( x, res ) ;
 		}
 
 		template <typename T, typename value_type>
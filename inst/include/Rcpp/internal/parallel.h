@@ -0,0 +1,122 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// parallel.h: Rcpp R/C++ interface class library -- splitting loops across threads
+//
+// Copyright (C) 2026  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp__internal__parallel__h
+#define Rcpp__internal__parallel__h
+
+// Threads are only ever started when a caller explicitly asks for more
+// than one; defining RCPP_NO_THREADS turns every parallel loop into a
+// plain serial loop and drops the dependency on <thread>.
+#ifndef RCPP_NO_THREADS
+#include <thread>
+#include <exception>
+#endif
+
+namespace Rcpp {
+namespace traits {
+
+    // element types that can be written from a worker thread without
+    // going through the R API (no allocation, no write barrier)
+    template <int RTYPE> struct is_thread_safe_rtype : public false_type {} ;
+    template <> struct is_thread_safe_rtype<INTSXP>  : public true_type {} ;
+    template <> struct is_thread_safe_rtype<REALSXP> : public true_type {} ;
+    template <> struct is_thread_safe_rtype<LGLSXP>  : public true_type {} ;
+    template <> struct is_thread_safe_rtype<CPLXSXP> : public true_type {} ;
+    template <> struct is_thread_safe_rtype<RAWSXP>  : public true_type {} ;
+
+} // traits
+
+namespace internal {
+
+    // number of threads actually worth starting for n units of work
+    // when each thread should get at least 'grain' of them
+    inline int parallel_threads( R_xlen_t n, int nthreads, R_xlen_t grain = 1 ){
+#ifdef RCPP_NO_THREADS
+        (void)n ; (void)nthreads ; (void)grain ;
+        return 1 ;
+#else
+        if( nthreads <= 1 || n <= grain ) return 1 ;
+        R_xlen_t most = n / ( grain > 0 ? grain : 1 ) ;
+        return static_cast<int>( std::min<R_xlen_t>( nthreads, most ) ) ;
+#endif
+    }
+
+    // Calls fun(begin, end) on the consecutive, non overlapping ranges
+    // bounds[k], bounds[k+1]. The first range runs on the calling thread,
+    // the others on worker threads. fun must not call into R. The first
+    // exception thrown by any range is rethrown once all threads joined.
+    template <typename Fun>
+    inline void parallel_ranges( const std::vector<R_xlen_t>& bounds, Fun fun ){
+        int nchunks = static_cast<int>( bounds.size() ) - 1 ;
+        if( nchunks <= 0 ) return ;
+#ifndef RCPP_NO_THREADS
+        if( nchunks > 1 ){
+            std::vector<std::exception_ptr> errors( nchunks ) ;
+            auto run = [&fun, &bounds, &errors]( int k ){
+                try {
+                    fun( bounds[k], bounds[k+1] ) ;
+                } catch( ... ){
+                    errors[k] = std::current_exception() ;
+                }
+            } ;
+            std::vector<std::thread> workers ;
+            workers.reserve( nchunks - 1 ) ;
+            for( int k=1; k<nchunks; k++ ){
+                try {
+                    workers.push_back( std::thread( run, k ) ) ;
+                } catch( ... ){
+                    // the system refused another thread, do this part here
+                    run( k ) ;
+                }
+            }
+            run( 0 ) ;
+            for( size_t k=0; k<workers.size(); k++ ) workers[k].join() ;
+            for( int k=0; k<nchunks; k++ ){
+                if( errors[k] ) std::rethrow_exception( errors[k] ) ;
+            }
+            return ;
+        }
+#endif
+        fun( bounds[0], bounds[1] ) ;
+    }
+
+    // boundaries of the parallel_threads( n, nthreads, grain ) ranges of
+    // (nearly) the same length that split [0, n)
+    inline std::vector<R_xlen_t> parallel_bounds( R_xlen_t n, int nthreads, R_xlen_t grain = 1 ){
+        int nt = parallel_threads( n, nthreads, grain ) ;
+        std::vector<R_xlen_t> bounds( nt + 1 ) ;
+        for( int k=0; k<=nt; k++ ){
+            bounds[k] = static_cast<R_xlen_t>( static_cast<double>(n) * k / nt ) ;
+        }
+        bounds[nt] = n ;
+        return bounds ;
+    }
+
+    // splits [0, n) into nthreads ranges of (nearly) the same length
+    template <typename Fun>
+    inline void parallel_for( R_xlen_t n, int nthreads, Fun fun, R_xlen_t grain = 1 ){
+        parallel_ranges( parallel_bounds( n, nthreads, grain ), fun ) ;
+    }
+
+} // internal
+} // Rcpp
+
+#endif
@@ -52,9 +52,9 @@ inline int r_coerce<LGLSXP,INTSXP>(int from){
 }
 template <>
 inline int r_coerce<REALSXP,INTSXP>(double from){
-	if (Rcpp_IsNA(from)) {
+	if (ISNAN(from)) {
 		return NA_INTEGER;
-	} else if (from > INT_MAX || from <= INT_MIN ) {
+	} else if (from >= INT_MAX + 1. || from <= INT_MIN ) {
 		return NA_INTEGER;
 	}
 	return static_cast<int>(from);
@@ -90,7 +90,7 @@ inline double r_coerce<RAWSXP,REALSXP>(Rbyte from){
 // -> LGLSXP
 template <>
 inline int r_coerce<REALSXP,LGLSXP>(double from){
-	return Rcpp_IsNA(from) ? NA_LOGICAL : (from!=0.0);
+	return ISNAN(from) ? NA_LOGICAL : (from!=0.0);
 }
 
 template <>
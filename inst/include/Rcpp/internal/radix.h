@@ -0,0 +1,407 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// radix.h: Rcpp R/C++ interface class library -- radix sorting and ordering
+//
+// Copyright (C) 2026  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp__internal__radix__h
+#define Rcpp__internal__radix__h
+
+#include <cstring>
+
+// below this many elements a comparison sort beats the fixed cost of
+// the 256 bucket histograms
+#ifndef RCPP_RADIX_SMALL
+#define RCPP_RADIX_SMALL 64
+#endif
+
+// minimum number of elements per thread in the parallel passes
+#ifndef RCPP_RADIX_GRAIN
+#define RCPP_RADIX_GRAIN 65536
+#endif
+
+namespace Rcpp {
+namespace internal {
+
+    // Keys are unsigned integers whose natural order is the requested
+    // order of the values: the sign bit of an int is flipped, a double
+    // has its sign bit flipped when positive and all bits flipped when
+    // negative, and decreasing order simply complements the key.
+    // Missing values never reach the key functions, they are set aside
+    // by the callers.
+
+    inline uint32_t radix_key( int x, bool decreasing ){
+        uint32_t k = static_cast<uint32_t>( x ) ^ 0x80000000u ;
+        return decreasing ? ~k : k ;
+    }
+    inline int radix_value( uint32_t k, bool decreasing ){
+        if( decreasing ) k = ~k ;
+        k ^= 0x80000000u ;
+        int x ;
+        std::memcpy( &x, &k, sizeof(int) ) ;
+        return x ;
+    }
+
+    inline uint64_t radix_key( double x, bool decreasing ){
+        uint64_t k ;
+        std::memcpy( &k, &x, sizeof(double) ) ;
+        k = ( k >> 63 ) ? ~k : ( k | 0x8000000000000000ull ) ;
+        return decreasing ? ~k : k ;
+    }
+    inline double radix_value( uint64_t k, bool decreasing ){
+        if( decreasing ) k = ~k ;
+        k = ( k >> 63 ) ? ( k ^ 0x8000000000000000ull ) : ~k ;
+        double x ;
+        std::memcpy( &x, &k, sizeof(double) ) ;
+        return x ;
+    }
+
+    // 0 for a regular value, 1 for NA, 2 for any other NaN. Missing
+    // values go after all the others in this order, which is where
+    // NAComparator puts them.
+    inline int radix_missing( int x ){
+        return x == NA_INTEGER ? 1 : 0 ;
+    }
+    inline int radix_missing( double x ){
+        if( x == x ) return 0 ;
+        return Rcpp_IsNA( x ) ? 1 : 2 ;
+    }
+
+    template <typename T> struct radix_key_type ;
+    template <> struct radix_key_type<int>{ typedef uint32_t type ; } ;
+    template <> struct radix_key_type<double>{ typedef uint64_t type ; } ;
+
+    template <typename Key>
+    struct radix_pair_less {
+        inline bool operator()( const std::pair<Key,int>& x, const std::pair<Key,int>& y ) const {
+            return x.first < y.first ;
+        }
+    } ;
+
+    // Stable least significant digit radix sort of keys[0,n), one byte
+    // per pass. When idx is not NULL it is permuted along with the keys.
+    // Passes where every key has the same byte are skipped. With more
+    // than one thread each thread counts and then scatters its own
+    // slice of the input, which keeps the sort stable.
+    template <typename Key>
+    inline void radix_sort_keys( Key* keys, int* idx, R_xlen_t n, int nthreads = 1 ){
+        if( n < 2 ) return ;
+        if( n < RCPP_RADIX_SMALL ){
+            std::vector< std::pair<Key,int> > tmp( n ) ;
+            for( R_xlen_t i=0; i<n; i++ ){
+                tmp[i].first = keys[i] ;
+                tmp[i].second = idx ? idx[i] : 0 ;
+            }
+            std::stable_sort( tmp.begin(), tmp.end(), radix_pair_less<Key>() ) ;
+            for( R_xlen_t i=0; i<n; i++ ){
+                keys[i] = tmp[i].first ;
+                if( idx ) idx[i] = tmp[i].second ;
+            }
+            return ;
+        }
+
+        const int passes = sizeof(Key) ;
+        int nt = parallel_threads( n, nthreads, RCPP_RADIX_GRAIN ) ;
+        std::vector<R_xlen_t> bounds( nt + 1 ) ;
+        for( int t=0; t<=nt; t++ ){
+            bounds[t] = static_cast<R_xlen_t>( static_cast<double>(n) * t / nt ) ;
+        }
+        bounds[nt] = n ;
+
+        // one read of the data gives the histograms of every digit
+        std::vector<R_xlen_t> counts( static_cast<size_t>(nt) * passes * 256, 0 ) ;
+        parallel_ranges( bounds, [&]( R_xlen_t begin, R_xlen_t end ){
+            size_t t = std::lower_bound( bounds.begin(), bounds.end(), begin ) - bounds.begin() ;
+            R_xlen_t* cnt = &counts[ t * passes * 256 ] ;
+            for( R_xlen_t i=begin; i<end; i++ ){
+                Key k = keys[i] ;
+                for( int p=0; p<passes; p++ ){
+                    cnt[ p * 256 + ( ( k >> ( 8 * p ) ) & 0xFF ) ]++ ;
+                }
+            }
+        }) ;
+
+        std::vector<Key> key_buffer( n ) ;
+        std::vector<int> idx_buffer( idx ? n : 0 ) ;
+        Key* src = keys ;
+        Key* dst = &key_buffer[0] ;
+        int* isrc = idx ;
+        int* idst = idx ? &idx_buffer[0] : 0 ;
+        std::vector<R_xlen_t> offsets( static_cast<size_t>(nt) * 256 ) ;
+
+        for( int p=0; p<passes; p++ ){
+            int shift = 8 * p ;
+
+            // a digit shared by all keys does not move anything
+            bool trivial = false ;
+            for( int b=0; b<256; b++ ){
+                R_xlen_t total = 0 ;
+                for( int t=0; t<nt; t++ ) total += counts[ ( t * passes + p ) * 256 + b ] ;
+                if( total == n ){ trivial = true ; break ; }
+                if( total > 0 ) break ;
+            }
+            if( trivial ) continue ;
+
+            // the per thread histograms of the first pass are right as
+            // they are, later passes see the data in a different order
+            // and need to count again
+            if( nt > 1 && p > 0 ){
+                parallel_ranges( bounds, [&]( R_xlen_t begin, R_xlen_t end ){
+                    size_t t = std::lower_bound( bounds.begin(), bounds.end(), begin ) - bounds.begin() ;
+                    R_xlen_t* cnt = &counts[ ( t * passes + p ) * 256 ] ;
+                    std::fill( cnt, cnt + 256, 0 ) ;
+                    for( R_xlen_t i=begin; i<end; i++ ){
+                        cnt[ ( src[i] >> shift ) & 0xFF ]++ ;
+                    }
+                }) ;
+            }
+
+            R_xlen_t running = 0 ;
+            for( int b=0; b<256; b++ ){
+                for( int t=0; t<nt; t++ ){
+                    offsets[ t * 256 + b ] = running ;
+                    running += counts[ ( t * passes + p ) * 256 + b ] ;
+                }
+            }
+
+            parallel_ranges( bounds, [&]( R_xlen_t begin, R_xlen_t end ){
+                size_t t = std::lower_bound( bounds.begin(), bounds.end(), begin ) - bounds.begin() ;
+                R_xlen_t* off = &offsets[ t * 256 ] ;
+                if( isrc ){
+                    for( R_xlen_t i=begin; i<end; i++ ){
+                        R_xlen_t pos = off[ ( src[i] >> shift ) & 0xFF ]++ ;
+                        dst[pos] = src[i] ;
+                        idst[pos] = isrc[i] ;
+                    }
+                } else {
+                    for( R_xlen_t i=begin; i<end; i++ ){
+                        dst[ off[ ( src[i] >> shift ) & 0xFF ]++ ] = src[i] ;
+                    }
+                }
+            }) ;
+            std::swap( src, dst ) ;
+            std::swap( isrc, idst ) ;
+        }
+
+        if( src != keys ){
+            std::copy( src, src + n, keys ) ;
+            if( idx ) std::copy( isrc, isrc + n, idx ) ;
+        }
+    }
+
+    // Sorts x[0,n) in place, with the same result as std::sort with
+    // NAComparator (or NAComparatorGreater when decreasing): missing
+    // values last (first when decreasing), NA before NaN. The only
+    // freedom std::sort had and this does not is the relative order of
+    // -0.0 and 0.0, which compare equal: -0.0 comes first.
+    template <typename T>
+    inline void radix_sort( T* x, R_xlen_t n, bool decreasing = false, int nthreads = 1 ){
+        typedef typename radix_key_type<T>::type Key ;
+        std::vector<Key> keys ;
+        keys.reserve( n ) ;
+        // missing values keep their bits (NaN payloads) and their order
+        std::vector<T> nas, nans ;
+        for( R_xlen_t i=0; i<n; i++ ){
+            switch( radix_missing( x[i] ) ){
+            case 0: keys.push_back( radix_key( x[i], decreasing ) ) ; break ;
+            case 1: nas.push_back( x[i] ) ; break ;
+            default: nans.push_back( x[i] ) ; break ;
+            }
+        }
+        R_xlen_t m = keys.size() ;
+        radix_sort_keys( m ? &keys[0] : static_cast<Key*>(0), static_cast<int*>(0), m, nthreads ) ;
+
+        T* out = x ;
+        if( decreasing ){
+            out = std::copy( nans.begin(), nans.end(), out ) ;
+            out = std::copy( nas.begin(), nas.end(), out ) ;
+        }
+        for( R_xlen_t i=0; i<m; i++ ) *out++ = radix_value( keys[i], decreasing ) ;
+        if( !decreasing ){
+            out = std::copy( nas.begin(), nas.end(), out ) ;
+            std::copy( nans.begin(), nans.end(), out ) ;
+        }
+    }
+
+    // Writes to idx[0,n) the 0 based positions that put x in order,
+    // like R's order(): ties keep their original order and missing
+    // values always come last (NA before NaN), also when decreasing.
+    // -0.0 and 0.0 are ties here.
+    template <typename T>
+    inline void radix_order( const T* x, int* idx, R_xlen_t n, bool decreasing = false, int nthreads = 1 ){
+        typedef typename radix_key_type<T>::type Key ;
+        std::vector<Key> keys ;
+        keys.reserve( n ) ;
+        int* out = idx ;
+        for( R_xlen_t i=0; i<n; i++ ){
+            if( !radix_missing( x[i] ) ){
+                // + 0 turns -0.0 into 0.0 and leaves ints alone
+                keys.push_back( radix_key( static_cast<T>( x[i] + 0 ), decreasing ) ) ;
+                *out++ = static_cast<int>(i) ;
+            }
+        }
+        R_xlen_t m = keys.size() ;
+        for( int kind=1; kind<=2; kind++ ){
+            for( R_xlen_t i=0; i<n; i++ ){
+                if( radix_missing( x[i] ) == kind ) *out++ = static_cast<int>(i) ;
+            }
+        }
+        radix_sort_keys( m ? &keys[0] : static_cast<Key*>(0), idx, m, nthreads ) ;
+    }
+
+    // Most significant digit radix ordering of C strings, compared byte
+    // wise like strcmp. idx[0,n) holds positions into s and is reordered,
+    // stably. Buckets are processed from an explicit stack so that long
+    // common prefixes cannot overflow the C stack; small buckets finish
+    // with a comparison sort on the remaining suffixes.
+    struct radix_suffix_less {
+        radix_suffix_less( const char* const* s_, size_t depth_, bool decreasing_ ) :
+            s(s_), depth(depth_), decreasing(decreasing_){}
+        inline bool operator()( int a, int b ) const {
+            int c = std::strcmp( s[a] + depth, s[b] + depth ) ;
+            return decreasing ? c > 0 : c < 0 ;
+        }
+        const char* const* s ;
+        size_t depth ;
+        bool decreasing ;
+    } ;
+
+    struct radix_string_task {
+        R_xlen_t begin, end ;
+        size_t depth ;
+    } ;
+
+    // splits idx[begin,end) on the byte at 'depth', pushes the buckets
+    // that still need work and returns the bucket boundaries
+    inline void radix_string_split( const char* const* s, int* idx, int* buffer, const radix_string_task& task,
+        bool decreasing, std::vector<radix_string_task>& stack, std::vector<radix_string_task>* buckets = 0 ){
+        R_xlen_t count[256] ;
+        std::fill( count, count + 256, 0 ) ;
+        for( R_xlen_t i=task.begin; i<task.end; i++ ){
+            count[ static_cast<unsigned char>( s[ idx[i] ][ task.depth ] ) ]++ ;
+        }
+        // the strings that end here are the smallest, slot 0 of the
+        // order in both directions puts them first or last
+        R_xlen_t start[256] ;
+        R_xlen_t running = task.begin ;
+        if( !decreasing ){
+            for( int b=0; b<256; b++ ){ start[b] = running ; running += count[b] ; }
+        } else {
+            for( int b=255; b>=0; b-- ){ start[b] = running ; running += count[b] ; }
+        }
+        R_xlen_t pos[256] ;
+        std::copy( start, start + 256, pos ) ;
+        for( R_xlen_t i=task.begin; i<task.end; i++ ){
+            buffer[ pos[ static_cast<unsigned char>( s[ idx[i] ][ task.depth ] ) ]++ ] = idx[i] ;
+        }
+        std::copy( buffer + task.begin, buffer + task.end, idx + task.begin ) ;
+        for( int b=1; b<256; b++ ){
+            if( count[b] > 1 ){
+                radix_string_task sub = { start[b], start[b] + count[b], task.depth + 1 } ;
+                if( buckets ) buckets->push_back( sub ) ; else stack.push_back( sub ) ;
+            }
+        }
+    }
+
+    inline void radix_string_run( const char* const* s, int* idx, int* buffer, std::vector<radix_string_task>& stack, bool decreasing ){
+        while( !stack.empty() ){
+            radix_string_task task = stack.back() ;
+            stack.pop_back() ;
+            if( task.end - task.begin < RCPP_RADIX_SMALL ){
+                std::stable_sort( idx + task.begin, idx + task.end, radix_suffix_less( s, task.depth, decreasing ) ) ;
+            } else {
+                radix_string_split( s, idx, buffer, task, decreasing, stack ) ;
+            }
+        }
+    }
+
+    inline void radix_order_strings( const char* const* s, int* idx, R_xlen_t n, bool decreasing = false, int nthreads = 1 ){
+        if( n < 2 ) return ;
+        std::vector<int> buffer( n ) ;
+        std::vector<radix_string_task> stack ;
+        radix_string_task all = { 0, n, 0 } ;
+        int nt = parallel_threads( n, nthreads, RCPP_RADIX_GRAIN ) ;
+        if( nt == 1 || n < RCPP_RADIX_SMALL ){
+            stack.push_back( all ) ;
+            radix_string_run( s, idx, &buffer[0], stack, decreasing ) ;
+            return ;
+        }
+        // first byte on this thread, then the buckets, which touch
+        // disjoint parts of idx, are shared out in groups of similar size
+        std::vector<radix_string_task> buckets ;
+        radix_string_split( s, idx, &buffer[0], all, decreasing, stack, &buckets ) ;
+        std::vector<R_xlen_t> bounds( 1, 0 ) ;
+        R_xlen_t target = n / nt, filled = 0 ;
+        for( size_t k=0; k<buckets.size(); k++ ){
+            filled += buckets[k].end - buckets[k].begin ;
+            if( filled >= target && k + 1 < buckets.size() ){
+                bounds.push_back( k + 1 ) ;
+                filled = 0 ;
+            }
+        }
+        bounds.push_back( buckets.size() ) ;
+        parallel_ranges( bounds, [&]( R_xlen_t first, R_xlen_t last ){
+            std::vector<radix_string_task> local( buckets.begin() + first, buckets.begin() + last ) ;
+            radix_string_run( s, idx, &buffer[0], local, decreasing ) ;
+        }) ;
+    }
+
+    // STRSXP versions, NA_STRING is missing and goes last (first when
+    // sorting in decreasing order, as NAComparatorGreater does)
+    inline void radix_order( const SEXP* x, int* idx, R_xlen_t n, bool decreasing = false, int nthreads = 1 ){
+        std::vector<const char*> s( n ) ;
+        R_xlen_t m = 0 ;
+        for( R_xlen_t i=0; i<n; i++ ){
+            if( x[i] != NA_STRING ){
+                s[i] = char_nocheck( x[i] ) ;
+                idx[m++] = static_cast<int>(i) ;
+            }
+        }
+        for( R_xlen_t i=0, j=m; i<n; i++ ){
+            if( x[i] == NA_STRING ) idx[j++] = static_cast<int>(i) ;
+        }
+        radix_order_strings( n ? &s[0] : static_cast<const char**>(0), idx, m, decreasing, nthreads ) ;
+    }
+
+    inline void radix_sort( SEXP* x, R_xlen_t n, bool decreasing = false, int nthreads = 1 ){
+        std::vector<int> idx( n ) ;
+        radix_order( x, n ? &idx[0] : static_cast<int*>(0), n, decreasing, nthreads ) ;
+        R_xlen_t n_na = std::count( x, x + n, NA_STRING ) ;
+        std::vector<SEXP> sorted( n ) ;
+        R_xlen_t j = 0 ;
+        if( decreasing ){
+            for( ; j<n_na; j++ ) sorted[j] = NA_STRING ;
+        }
+        for( R_xlen_t i=0; i<n - n_na; i++ ) sorted[j++] = x[ idx[i] ] ;
+        for( ; j<n; j++ ) sorted[j] = NA_STRING ;
+        std::copy( sorted.begin(), sorted.end(), x ) ;
+    }
+
+    // complex numbers have no useful radix key
+    inline void radix_sort( Rcomplex* x, R_xlen_t n, bool decreasing = false, int /*nthreads*/ = 1 ){
+        if( !decreasing ){
+            std::sort( x, x + n, NAComparator<Rcomplex>() ) ;
+        } else {
+            std::sort( x, x + n, NAComparatorGreater<Rcomplex>() ) ;
+        }
+    }
+
+} // internal
+} // Rcpp
+
+#endif
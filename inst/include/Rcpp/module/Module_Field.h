@@ -34,6 +34,12 @@ public:
 
     SEXP get(Class* object) { return Rcpp::wrap( object->*ptr ) ; }
     void set(Class* object, SEXP value) { object->*ptr = Rcpp::as<PROP>( value ) ; }
+    SEXP get_many(Class** objects, R_xlen_t n) {
+	return Rcpp::internal::property_column<PROP>( objects, n, [this](Class* object) -> const PROP& { return object->*ptr ; } ) ;
+    }
+    void set_many(Class** objects, R_xlen_t n, SEXP values) {
+	Rcpp::internal::set_property_column<PROP>( objects, n, values, [this](Class* object, const PROP& value){ object->*ptr = value ; } ) ;
+    }
     bool is_readonly(){ return false ; }
     std::string get_class(){ return class_name; }
 
@@ -55,6 +61,9 @@ public:
 
     SEXP get(Class* object) { return Rcpp::wrap( object->*ptr ) ; }
     void set(Class* object, SEXP value) { throw std::range_error("read only data member") ; }
+    SEXP get_many(Class** objects, R_xlen_t n) {
+	return Rcpp::internal::property_column<PROP>( objects, n, [this](Class* object) -> const PROP& { return object->*ptr ; } ) ;
+    }
     bool is_readonly(){ return true ; }
     std::string get_class(){ return class_name; }
 
@@ -35,6 +35,9 @@ public:
     SEXP get(Class* object) { return Rcpp::wrap((object->*getter)()); }
     void set(Class*, SEXP) { throw std::range_error("property is read only"); }
     bool is_readonly(){ return true; }
+    SEXP get_many(Class** objects, R_xlen_t n) {
+        return Rcpp::internal::property_column<PROP>(objects, n, [this](Class* object) -> PROP { return (object->*getter)(); });
+    }
     std::string get_class(){ return class_name; }
 
 private:
@@ -56,6 +59,9 @@ public:
     SEXP get(Class* object) { return Rcpp::wrap((object->*getter)()); }
     void set(Class*, SEXP) { throw std::range_error("property is read only"); }
     bool is_readonly(){ return true; }
+    SEXP get_many(Class** objects, R_xlen_t n) {
+        return Rcpp::internal::property_column<PROP>(objects, n, [this](Class* object) -> PROP { return (object->*getter)(); });
+    }
     std::string get_class(){ return class_name; }
 
 private:
@@ -78,6 +84,9 @@ public:
     SEXP get(Class* object) { return Rcpp::wrap(getter(object)); }
     void set(Class*, SEXP) { throw std::range_error("property is read only"); }
     bool is_readonly(){ return true; }
+    SEXP get_many(Class** objects, R_xlen_t n) {
+        return Rcpp::internal::property_column<PROP>(objects, n, [this](Class* object) -> PROP { return getter(object); });
+    }
     std::string get_class(){ return class_name; }
 
 private:
@@ -104,6 +113,13 @@ public:
         (object->*setter)(Rcpp::as< typename Rcpp::traits::remove_const_and_reference< PROP >::type >(value));
     }
     bool is_readonly(){ return false; }
+    SEXP get_many(Class** objects, R_xlen_t n) {
+        return Rcpp::internal::property_column<PROP>(objects, n, [this](Class* object) -> PROP { return (object->*getter)(); });
+    }
+    void set_many(Class** objects, R_xlen_t n, SEXP values) {
+        Rcpp::internal::set_property_column<PROP>(objects, n, values,
+            [this](Class* object, const typename Rcpp::traits::remove_const_and_reference<PROP>::type& value) { (object->*setter)(value); });
+    }
     std::string get_class(){ return class_name; }
 
 private:
@@ -128,6 +144,13 @@ public:
         (object->*setter)(Rcpp::as< typename Rcpp::traits::remove_const_and_reference< PROP >::type >(value));
     }
     bool is_readonly(){ return false; }
+    SEXP get_many(Class** objects, R_xlen_t n) {
+        return Rcpp::internal::property_column<PROP>(objects, n, [this](Class* object) -> PROP { return (object->*getter)(); });
+    }
+    void set_many(Class** objects, R_xlen_t n, SEXP values) {
+        Rcpp::internal::set_property_column<PROP>(objects, n, values,
+            [this](Class* object, const typename Rcpp::traits::remove_const_and_reference<PROP>::type& value) { (object->*setter)(value); });
+    }
     std::string get_class(){ return class_name; }
 
 private:
@@ -158,6 +181,13 @@ public:
         setter(object, Rcpp::as< typename Rcpp::traits::remove_const_and_reference< PROP >::type >(value));
     }
     bool is_readonly(){ return false; }
+    SEXP get_many(Class** objects, R_xlen_t n) {
+        return Rcpp::internal::property_column<PROP>(objects, n, [this](Class* object) -> PROP { return (object->*getter)(); });
+    }
+    void set_many(Class** objects, R_xlen_t n, SEXP values) {
+        Rcpp::internal::set_property_column<PROP>(objects, n, values,
+            [this](Class* object, const typename Rcpp::traits::remove_const_and_reference<PROP>::type& value) { setter(object, value); });
+    }
     std::string get_class(){ return class_name; }
 
 private:
@@ -183,6 +213,13 @@ public:
         setter(object, Rcpp::as< typename Rcpp::traits::remove_const_and_reference< PROP >::type >(value));
     }
     bool is_readonly(){ return false; }
+    SEXP get_many(Class** objects, R_xlen_t n) {
+        return Rcpp::internal::property_column<PROP>(objects, n, [this](Class* object) -> PROP { return (object->*getter)(); });
+    }
+    void set_many(Class** objects, R_xlen_t n, SEXP values) {
+        Rcpp::internal::set_property_column<PROP>(objects, n, values,
+            [this](Class* object, const typename Rcpp::traits::remove_const_and_reference<PROP>::type& value) { setter(object, value); });
+    }
     std::string get_class(){ return class_name; }
 
 private:
@@ -210,6 +247,13 @@ public:
         (object->*setter)(Rcpp::as< typename Rcpp::traits::remove_const_and_reference< PROP >::type >(value));
     }
     bool is_readonly(){ return false; }
+    SEXP get_many(Class** objects, R_xlen_t n) {
+        return Rcpp::internal::property_column<PROP>(objects, n, [this](Class* object) -> PROP { return getter(object); });
+    }
+    void set_many(Class** objects, R_xlen_t n, SEXP values) {
+        Rcpp::internal::set_property_column<PROP>(objects, n, values,
+            [this](Class* object, const typename Rcpp::traits::remove_const_and_reference<PROP>::type& value) { (object->*setter)(value); });
+    }
     std::string get_class(){ return class_name; }
 
 private:
@@ -238,6 +282,13 @@ public:
         setter(object, Rcpp::as< typename Rcpp::traits::remove_const_and_reference< PROP >::type >(value));
     }
     bool is_readonly(){ return false; }
+    SEXP get_many(Class** objects, R_xlen_t n) {
+        return Rcpp::internal::property_column<PROP>(objects, n, [this](Class* object) -> PROP { return getter(object); });
+    }
+    void set_many(Class** objects, R_xlen_t n, SEXP values) {
+        Rcpp::internal::set_property_column<PROP>(objects, n, values,
+            [this](Class* object, const typename Rcpp::traits::remove_const_and_reference<PROP>::type& value) { setter(object, value); });
+    }
     std::string get_class(){ return class_name; }
 
 private:
@@ -129,32 +129,41 @@
 
         SEXP newInstance( SEXP* args, int nargs ){
             BEGIN_RCPP
-                signed_constructor_class* p ;
-            size_t n = constructors.size() ;
-            for( size_t i=0; i<n; i++ ){
-                p = constructors[i];
-                bool ok = (p->valid)(args, nargs) ;
-                if( ok ){
-                    Class* ptr = p->ctor->get_new( args, nargs ) ;
-                    return XP( ptr, true ) ;
+            return XP( new_object( args, nargs ), true ) ;
+            END_RCPP
                 }
-            }
 
-            signed_factory_class* pfact ;
-            n = factories.size() ;
-            for( size_t i=0; i<n; i++){
-              pfact = factories[i] ;
-              bool ok = (pfact->valid)(args, nargs) ;
-              if( ok ){
-                Class* ptr = pfact->fact->get_new( args, nargs ) ;
-                return XP( ptr, true ) ;
-              }
-            }
+        // the object is owned by an external pointer tagged with the
+        // class, which runs the finalizer of the class before deleting it
+        SEXP newLightweightInstance( SEXP class_xp, SEXP* args, int nargs ){
+            BEGIN_RCPP
+            return lightweight_pointer( class_xp, new_object( args, nargs ) ) ;
+            END_RCPP
+                }
 
-            throw std::range_error( "no valid constructor available for the argument list" ) ;
+        // takes the object over from the external pointer object, as made
+        // by make_new_object() with the default finalizer, into one like
+        // those of newLightweightInstance()
+        SEXP adoptLightweightInstance( SEXP class_xp, SEXP object ){
+            BEGIN_RCPP
+            Class* ptr = reinterpret_cast<Class*>( R_ExternalPtrAddr( object ) ) ;
+            if( ptr == 0 ) throw not_initialized() ;
+            R_ClearExternalPtr( object ) ;
+            return lightweight_pointer( class_xp, ptr ) ;
             END_RCPP
                 }
 
+        /**
+         * Objects of the class are made as bare external pointers with a
+         * class attribute, whose methods and fields are reached through a
+         * table shared by all objects of the class, instead of reference
+         * class objects. This makes creating an object much cheaper.
+         */
+        self& lightweight( bool value = true ){
+            get_instance()->lightweight_objects = value ;
+            return *this ;
+        }
+
         bool has_default_constructor(){
             size_t n = constructors.size() ;
             signed_constructor_class* p ;
@@ -242,6 +251,51 @@
             END_RCPP
                 }
 
+        // calls the method on each of the n objects, the overload being
+        // chosen once from the arguments of the first call
+        SEXP invoke_many( const char* method_name, SEXP* objects, R_xlen_t n, SEXP* args, int nargs ){
+            BEGIN_RCPP
+
+            typename map_vec_signed_method::iterator found = vec_methods.find( method_name ) ;
+            if( found == vec_methods.end() ){
+                throw std::range_error( "no such method" ) ;
+            }
+            vec_signed_method* mets = found->second ;
+            Rcpp::List res( n ) ;
+            if( n == 0 ) return res ;
+
+            Rcpp::List buffer( nargs ) ;
+            std::vector<SEXP> call_args( nargs + 1 ) ;
+            method_class* m = 0 ;
+            for( R_xlen_t i=0; i<n; i++ ){
+                for( int j=0; j<nargs; j++ ){
+                    SEXP arg = internal::recycled_element( args[j], i ) ;
+                    if( arg != args[j] ) SET_VECTOR_ELT( buffer, j, arg ) ;
+                    call_args[j] = arg ;
+                }
+                if( m == 0 ){
+                    typename vec_signed_method::iterator it = mets->begin() ;
+                    for( ; it != mets->end(); ++it ){
+                        if( ( (*it)->valid )( &call_args[0], nargs ) ){
+                            m = (*it)->method ;
+                            break ;
+                        }
+                    }
+                    if( m == 0 ){
+                        throw std::range_error( "could not find valid method" ) ;
+                    }
+                }
+                Class* object = reinterpret_cast<Class*>( R_ExternalPtrAddr( objects[i] ) ) ;
+                if( object == 0 ){
+                    throw Rcpp::exception( "external pointer is not valid" ) ;
+                }
+                SEXP value = m->operator()( object, &call_args[0] ) ;
+                if( ! m->is_void() ) SET_VECTOR_ELT( res, i, value ) ;
+            }
+            if( m->is_void() ) return R_NilValue ;
+            return res ;
+            END_RCPP
+                }
 
         self& AddMethod( const char* name_, method_class* m, ValidMethod valid = &yes, const char* docstring = 0){
             RCPP_DEBUG_MODULE_1( "AddMethod( %s, method_class* m, ValidMethod valid = &yes, const char* docstring = 0", name_ )
@@ -447,6 +501,53 @@
                 }
 
 
+        // the properties called names of n objects, as a list of columns
+        SEXP getProperties( SEXP names, void** objects, R_xlen_t n ){
+            BEGIN_RCPP
+            Class** ptrs = object_array( objects, n ) ;
+            R_xlen_t k = Rf_xlength( names ) ;
+            Rcpp::List res( k ) ;
+            for( R_xlen_t j=0; j<k; j++ ){
+                res[j] = find_property( CHAR( STRING_ELT( names, j ) ) )->get_many( ptrs, n ) ;
+            }
+            res.names() = names ;
+            return res ;
+            END_RCPP
+                }
+
+        // sets the properties of n objects from a named list of columns
+        void setProperties( SEXP values, void** objects, R_xlen_t n ){
+            BEGIN_RCPP
+            Class** ptrs = object_array( objects, n ) ;
+            SEXP names = Rf_getAttrib( values, R_NamesSymbol ) ;
+            R_xlen_t k = Rf_xlength( values ) ;
+            for( R_xlen_t j=0; j<k; j++ ){
+                find_property( CHAR( STRING_ELT( names, j ) ) )->set_many( ptrs, n, VECTOR_ELT( values, j ) ) ;
+            }
+            VOID_END_RCPP
+                }
+
+        // the elements of a std::vector<Class> held by the external pointer
+        // xp, made by object_vector_xptr. n is -1 when xp is null and -2
+        // when it is not tagged as a vector of Class.
+        void** vector_elements( SEXP xp, R_xlen_t& n ){
+            SEXP tag = R_ExternalPtrTag( xp ) ;
+            if( TYPEOF(tag) != STRSXP || Rf_xlength(tag) != 1 ||
+                std::strcmp( CHAR( STRING_ELT(tag, 0) ), internal::object_vector_tag<Class>() ) ){
+                n = -2 ;
+                return 0 ;
+            }
+            std::vector<Class>* v = reinterpret_cast< std::vector<Class>* >( R_ExternalPtrAddr( xp ) ) ;
+            if( v == 0 ){
+                n = -1 ;
+                return 0 ;
+            }
+            n = v->size() ;
+            void** res = reinterpret_cast<void**>( R_alloc( n + 1, sizeof(void*) ) ) ;
+            for( R_xlen_t i=0; i<n; i++ ) res[i] = v->data() + i ;
+            return res ;
+        }
+
         Rcpp::List fields( const XP_Class& class_xp ){
             size_t n = properties.size() ;
             Rcpp::CharacterVector pnames(n) ;
@@ -502,6 +603,15 @@
             finalizer_pointer->run( XP(object) ) ;
         }
 
+        static void lightweight_finalizer( SEXP object ){
+            Class* ptr = reinterpret_cast<Class*>( R_ExternalPtrAddr( object ) ) ;
+            if( ptr == 0 ) return ;
+            class_Base* cl = reinterpret_cast<class_Base*>( R_ExternalPtrAddr( R_ExternalPtrTag( object ) ) ) ;
+            static_cast<self*>( cl )->finalizer_pointer->run( ptr ) ;
+            R_ClearExternalPtr( object ) ;
+            delete ptr ;
+        }
+
         void SetFinalizer( finalizer_class* f ){
             self* ptr = get_instance() ;
             if( ptr->finalizer_pointer ) delete ptr->finalizer_pointer ;
@@ -521,6 +631,48 @@
 
         class_( ) : class_Base(), vec_methods(), properties(), specials(0), constructors(), factories() {};
 
+        prop_class* find_property( const char* name_ ){
+            typename PROPERTY_MAP::iterator it = properties.find( name_ ) ;
+            if( it == properties.end() ) throw std::range_error( "no such property" ) ;
+            return it->second ;
+        }
+
+        static Class** object_array( void** objects, R_xlen_t n ){
+            Class** res = reinterpret_cast<Class**>( R_alloc( n + 1, sizeof(Class*) ) ) ;
+            for( R_xlen_t i=0; i<n; i++ ) res[i] = static_cast<Class*>( objects[i] ) ;
+            return res ;
+        }
+
+        SEXP lightweight_pointer( SEXP class_xp, Class* ptr ){
+            XP xp( ptr, false, class_xp, R_NilValue ) ;
+            R_RegisterCFinalizerEx( xp, lightweight_finalizer, FALSE ) ;
+            return xp ;
+        }
+
+        Class* new_object( SEXP* args, int nargs ){
+            signed_constructor_class* p ;
+            size_t n = constructors.size() ;
+            for( size_t i=0; i<n; i++ ){
+                p = constructors[i];
+                bool ok = (p->valid)(args, nargs) ;
+                if( ok ){
+                    return p->ctor->get_new( args, nargs ) ;
+                }
+            }
+
+            signed_factory_class* pfact ;
+            n = factories.size() ;
+            for( size_t i=0; i<n; i++){
+              pfact = factories[i] ;
+              bool ok = (pfact->valid)(args, nargs) ;
+              if( ok ){
+                return pfact->fact->get_new( args, nargs ) ;
+              }
+            }
+
+            throw std::range_error( "no valid constructor available for the argument list" ) ;
+        }
+
 
     public:
 
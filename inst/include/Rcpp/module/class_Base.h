@@ -23,13 +23,39 @@
 
 namespace Rcpp{
 
+namespace internal{
+
+    // element i of x, recycled, for the i-th of several calls: vectors are
+    // taken element by element and lists give their elements, so that
+    // list(v) passes v whole to every call. Other values of length one
+    // are used as is.
+    inline SEXP recycled_element( SEXP x, R_xlen_t i ){
+        if( TYPEOF(x) == VECSXP && Rf_xlength(x) == 1 ) return VECTOR_ELT( x, 0 ) ;
+        R_xlen_t n = Rf_xlength(x) ;
+        if( n == 1 || ! Rf_isVector(x) ) return x ;
+        if( n == 0 ) throw std::range_error( "zero length argument" ) ;
+        i = i % n ;
+        switch( TYPEOF(x) ){
+        case VECSXP:  return VECTOR_ELT( x, i ) ;
+        case LGLSXP:  return Rf_ScalarLogical( LOGICAL(x)[i] ) ;
+        case INTSXP:  return Rf_ScalarInteger( INTEGER(x)[i] ) ;
+        case REALSXP: return Rf_ScalarReal( REAL(x)[i] ) ;
+        case CPLXSXP: return Rf_ScalarComplex( COMPLEX(x)[i] ) ;
+        case STRSXP:  return Rf_ScalarString( STRING_ELT(x, i) ) ;
+        case RAWSXP:  return Rf_ScalarRaw( RAW(x)[i] ) ;
+        default:      return x ;
+        }
+    }
+
+}
+
 class class_Base {
 public:
     typedef Rcpp::XPtr<class_Base> XP_Class ;
 
-    class_Base() : name(), docstring(), enums(), parents() {} ;
+    class_Base() : name(), docstring(), enums(), parents(), lightweight_objects(false) {} ;
     class_Base(const char* name_, const char* doc) :
-        name(name_), docstring( doc == 0 ? "" : doc ), enums(), parents() {} ;
+        name(name_), docstring( doc == 0 ? "" : doc ), enums(), parents(), lightweight_objects(false) {} ;
 
     virtual Rcpp::List fields(const XP_Class& ){ return Rcpp::List(0); }
     virtual Rcpp::List getMethods(const XP_Class&, std::string&){ return Rcpp::List(0); }
@@ -47,6 +73,12 @@ public:
     virtual SEXP newInstance(SEXP *, int){
         return R_NilValue;
     }
+    virtual SEXP newLightweightInstance(SEXP, SEXP *, int){
+        return R_NilValue;
+    }
+    virtual SEXP adoptLightweightInstance(SEXP, SEXP){
+        return R_NilValue;
+    }
     virtual SEXP invoke( SEXP, SEXP, SEXP *, int ){
         return R_NilValue ;
     }
@@ -56,6 +88,9 @@ public:
     virtual SEXP invoke_notvoid( SEXP, SEXP, SEXP *, int ){
         return R_NilValue ;
     }
+    virtual SEXP invoke_many( const char*, SEXP*, R_xlen_t, SEXP*, int ){
+        return R_NilValue ;
+    }
 
     virtual Rcpp::CharacterVector method_names(){ return Rcpp::CharacterVector(0) ; }
     virtual Rcpp::CharacterVector property_names(){ return Rcpp::CharacterVector(0) ; }
@@ -74,6 +109,14 @@ public:
     virtual void setProperty( SEXP, SEXP, SEXP) {
         throw std::range_error( "cannot set property" ) ;
     }
+    virtual SEXP getProperties( SEXP, void**, R_xlen_t ){
+        return R_NilValue ;
+    }
+    virtual void setProperties( SEXP, void**, R_xlen_t ){}
+    virtual void** vector_elements( SEXP, R_xlen_t& n ){
+        n = -1 ;
+        return 0 ;
+    }
     virtual std::string get_typeinfo_name(){ return "" ; }
     bool has_typeinfo_name( const std::string& name_ ){
         return get_typeinfo_name().compare(name_) == 0;
@@ -91,6 +134,9 @@ public:
     ENUM_MAP enums ;
     std::vector<std::string> parents ;
 
+    // objects are bare external pointers rather than reference class objects
+    bool lightweight_objects ;
+
 } ;
 
 }
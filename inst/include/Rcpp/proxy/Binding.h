@@ -27,6 +27,8 @@ public:
     class Binding : public GenericProxy<Binding> {
     public:
         Binding( EnvironmentClass& env_, const std::string& name_) :
+            env(env_), name(Rf_install(name_.c_str())){}
+        Binding( EnvironmentClass& env_, SEXP name_) :
             env(env_), name(name_){}
 
         inline bool active() const {
@@ -66,12 +68,14 @@ public:
         }
 
         EnvironmentClass& env ;
-        std::string name ;
+        SEXP name ;         // symbol, installed once for all accesses through this binding
     } ;
 
     class const_Binding : public GenericProxy<const_Binding> {
     public:
         const_Binding( const EnvironmentClass& env_, const std::string& name_) :
+            env(env_), name(Rf_install(name_.c_str())){}
+        const_Binding( const EnvironmentClass& env_, SEXP name_) :
             env(env_), name(name_){}
 
         inline bool active() const {
@@ -92,7 +96,7 @@ public:
         }
 
         const EnvironmentClass& env ;
-        std::string name ;
+        SEXP name ;         // symbol, installed once for all accesses through this binding
     } ;
 
     const_Binding operator[]( const std::string& name) const {
@@ -101,6 +105,13 @@ public:
     Binding operator[](const std::string& name){
         return Binding( static_cast<EnvironmentClass&>(*this), name ) ;
     }
+    // from a symbol, e.g. env[RCPP_SYMBOL("x")]
+    const_Binding operator[]( SEXP name) const {
+        return const_Binding( static_cast<const EnvironmentClass&>(*this), name ) ;
+    }
+    Binding operator[]( SEXP name){
+        return Binding( static_cast<EnvironmentClass&>(*this), name ) ;
+    }
 
 } ;
 
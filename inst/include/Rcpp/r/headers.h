@@ -76,6 +76,15 @@
 #include <R_ext/Visibility.h>
 #include <Rversion.h>
 
+// ALTREP classes (used by lazy_wrap) need R 3.6.0, the first version with
+// alternative logical vectors and a C++ safe R_ext/Altrep.h
+#if defined(R_VERSION) && R_VERSION >= R_Version(3,6,0) && !defined(RCPP_NO_ALTREP)
+# define RCPP_HAS_ALTREP
+extern "C" {
+# include <R_ext/Altrep.h>
+}
+#endif
+
 /* Ensure NORET defined (normally provided by R headers with R >= 3.2.0) */
 #ifndef NORET
 # if defined(__GNUC__) && __GNUC__ >= 3
@@ -39,6 +39,11 @@ namespace Rcpp{
         unsigned long endSuspendRNGSynchronization();
         char* get_string_buffer();
         SEXP get_Rcpp_namespace();
+#if defined(RCPP_HAS_ALTREP)
+        SEXP make_lazy_vector(int rtype, void* source, const void* library);
+        bool lazy_vector_pending(SEXP x);
+        int compute_pending_lazy_vectors(const void* library);
+#endif
     }
     double mktime00(struct tm &);
     struct tm * gmtime_(const time_t * const);
@@ -124,6 +129,26 @@ namespace Rcpp {
             return fun();
         }
 
+#if defined(RCPP_HAS_ALTREP)
+        inline attribute_hidden SEXP make_lazy_vector(int rtype, void* source, const void* library) {
+            typedef SEXP (*Fun)(int, void*, const void*);
+            static Fun fun = GET_CALLABLE("make_lazy_vector");
+            return fun(rtype, source, library);
+        }
+
+        inline attribute_hidden bool lazy_vector_pending(SEXP x) {
+            typedef bool (*Fun)(SEXP);
+            static Fun fun = GET_CALLABLE("lazy_vector_pending");
+            return fun(x);
+        }
+
+        inline attribute_hidden int compute_pending_lazy_vectors(const void* library) {
+            typedef int (*Fun)(const void*);
+            static Fun fun = GET_CALLABLE("compute_pending_lazy_vectors");
+            return fun(library);
+        }
+#endif
+
     }
 
 
@@ -31,22 +31,12 @@ struct clamp_operator{
 
     clamp_operator(STORAGE lhs_, STORAGE rhs_ ) : lhs(lhs_), rhs(rhs_){}
 
+    // double NA and NaN compare false to both bounds and are kept
     inline STORAGE operator()(STORAGE x) const {
-        return x < lhs ? lhs : (x > rhs ? rhs : x ) ;
+        return kernels::clamp_value( x, lhs, rhs ) ;
     }
     STORAGE lhs, rhs ;
 } ;
-// need to write this special version
-template <>
-struct clamp_operator<REALSXP,true> {
-    clamp_operator(double lhs_, double rhs_ ) : lhs(lhs_), rhs(rhs_){}
-
-    inline double operator()(double x) const {
-        if( Rcpp::traits::is_na<REALSXP>(x) )  return x ;
-        return x < lhs ? lhs : (x > rhs ? rhs : x ) ;
-    }
-    double lhs, rhs ;
-} ;
 
 
 
@@ -62,6 +52,7 @@ class Clamp_Primitive_Vector_Primitive : public VectorBase<
 public:
 	typedef typename Rcpp::traits::storage_type<RTYPE>::type STORAGE ;
 	typedef clamp_operator<RTYPE,NA> OPERATOR ;
+	typedef typename kernels::all_direct<T>::type r_fill_kernel ;
 
 	Clamp_Primitive_Vector_Primitive( STORAGE lhs_, const T& vec_, STORAGE rhs_) : vec(vec_), op(lhs_,rhs_) {}
 
@@ -70,6 +61,15 @@ public:
 	}
         inline R_xlen_t size() const { return vec.size() ; }
 
+	// writes all the elements at once, out may be vec
+	inline void fill( STORAGE* out ) const {
+		kernels::Operand<STORAGE,T> x( vec ) ;
+		kernels::apply( x, size(), out, kernels::ClampKernel<STORAGE>( op.lhs, op.rhs ) ) ;
+	}
+
+	template <typename Iterator>
+	inline void fill( Iterator out ) const { kernels::fill_elements( *this, out ) ; }
+
 private:
 	const T& vec ;
 	OPERATOR op ;
@@ -25,10 +25,14 @@
 namespace Rcpp{
 
 template <int RTYPE, bool NA, typename T>
-inline LogicalVector duplicated( const VectorBase<RTYPE,NA,T>& x ){
+inline LogicalVector duplicated( const VectorBase<RTYPE,NA,T>& x, int nthreads = 1 ){
     Vector<RTYPE> vec(x) ;
-    sugar::IndexHash<RTYPE> hash(vec) ;
-    return hash.fill_and_get_duplicated() ;
+    std::vector<unsigned char> flags = sugar::first_flags<RTYPE>( vec, nthreads ) ;
+    R_xlen_t n = vec.size() ;
+    LogicalVector result = no_init(n) ;
+    int* res = LOGICAL(result) ;
+    for( R_xlen_t i=0; i<n; i++) res[i] = ! flags[i] ;
+    return result ;
 }
 
 
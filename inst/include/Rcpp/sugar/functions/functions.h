@@ -42,6 +42,7 @@
 #include <Rcpp/sugar/functions/sapply.h>
 #include <Rcpp/sugar/functions/mapply.h>
 #include <Rcpp/sugar/functions/lapply.h>
+#include <Rcpp/sugar/functions/map.h>
 #include <Rcpp/sugar/functions/ifelse.h>
 #include <Rcpp/sugar/functions/pmin.h>
 #include <Rcpp/sugar/functions/pmax.h>
@@ -66,6 +67,7 @@
 #include <Rcpp/sugar/functions/cumsum.h>
 #include <Rcpp/sugar/functions/which_min.h>
 #include <Rcpp/sugar/functions/which_max.h>
+#include <Rcpp/sugar/functions/order.h>
 
 #include <Rcpp/sugar/functions/unique.h>
 #include <Rcpp/sugar/functions/match.h>
@@ -73,14 +75,18 @@
 #include <Rcpp/sugar/functions/duplicated.h>
 #include <Rcpp/sugar/functions/self_match.h>
 #include <Rcpp/sugar/functions/setdiff.h>
+#include <Rcpp/sugar/functions/group_by.h>
+#include <Rcpp/sugar/functions/hash_join.h>
 
 #include <Rcpp/sugar/functions/strings/strings.h>
 
 #include <Rcpp/sugar/functions/cumprod.h>
 #include <Rcpp/sugar/functions/cummin.h>
 #include <Rcpp/sugar/functions/cummax.h>
+#include <Rcpp/sugar/functions/roll.h>
 
 #include <Rcpp/sugar/functions/median.h>
+#include <Rcpp/sugar/functions/quantile.h>
 
 #include <Rcpp/sugar/functions/cbind.h>
 
@@ -0,0 +1,410 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// group_by.h: Rcpp R/C++ interface class library -- grouped reductions
+//
+// Copyright (C) 2026  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp__sugar__group_by_h
+#define Rcpp__sugar__group_by_h
+
+namespace Rcpp{
+namespace sugar{
+namespace group_detail{
+
+    // keys spanning at most this many values per row (or 65536 values)
+    // are numbered through a table of direct addresses instead of a hash
+    const double direct_slots_per_row = 2.0 ;
+
+    inline bool use_direct_table( double slots, R_xlen_t n ){
+        return slots <= std::max( direct_slots_per_row * static_cast<double>(n), 65536.0 ) ;
+    }
+
+    // 0 based ids of the n values at src in order of first appearance,
+    // returns the number of distinct values
+    template <typename STORAGE>
+    inline int hashed_ids( const STORAGE* src, R_xlen_t n, int nthreads, int* out ){
+        hash_detail::self_match_ids<STORAGE,int> fun( src, n, nthreads, out ) ;
+        hash_detail::dispatch_index( n, fun ) ;
+        for( R_xlen_t i=0; i<n; i++ ) out[i]-- ;
+        return static_cast<int>( fun.groups ) ;
+    }
+
+    inline int integer_ids( const int* src, R_xlen_t n, int nthreads, int* out ){
+        int lo = std::numeric_limits<int>::max(), hi = std::numeric_limits<int>::min() ;
+        for( R_xlen_t i=0; i<n; i++ ){
+            int v = src[i] ;
+            if( v == NA_INTEGER ) continue ;
+            if( v < lo ) lo = v ;
+            if( v > hi ) hi = v ;
+        }
+        double range = lo <= hi ? static_cast<double>(hi) - lo + 1.0 : 0.0 ;
+        if( ! use_direct_table( range, n ) ) return hashed_ids( src, n, nthreads, out ) ;
+
+        // the last slot is for NA
+        R_xlen_t na_slot = static_cast<R_xlen_t>( range ) ;
+        std::vector<int> slots( na_slot + 1, -1 ) ;
+        int groups = 0 ;
+        for( R_xlen_t i=0; i<n; i++ ){
+            int v = src[i] ;
+            R_xlen_t s = v == NA_INTEGER ? na_slot : static_cast<R_xlen_t>(v) - lo ;
+            if( slots[s] < 0 ) slots[s] = groups++ ;
+            out[i] = slots[s] ;
+        }
+        return groups ;
+    }
+
+    // one group per level, in the order of the levels, then NA if present
+    inline int factor_ids( SEXP x, int* out ){
+        int nlevels = Rf_length( Rf_getAttrib( x, R_LevelsSymbol ) ) ;
+        const int* codes = INTEGER(x) ;
+        R_xlen_t n = Rf_xlength(x) ;
+        bool na = false ;
+        for( R_xlen_t i=0; i<n; i++ ){
+            int code = codes[i] ;
+            if( code == NA_INTEGER || code < 1 || code > nlevels ){
+                out[i] = nlevels ;
+                na = true ;
+            } else {
+                out[i] = code - 1 ;
+            }
+        }
+        return nlevels + ( na ? 1 : 0 ) ;
+    }
+
+    inline int column_ids( SEXP x, int nthreads, int* out, bool& by_level ){
+        R_xlen_t n = Rf_xlength(x) ;
+        by_level = false ;
+        switch( TYPEOF(x) ){
+        case INTSXP:
+            if( Rf_isFactor(x) ){
+                by_level = true ;
+                return factor_ids( x, out ) ;
+            }
+            return integer_ids( INTEGER(x), n, nthreads, out ) ;
+        case LGLSXP:
+            return integer_ids( LOGICAL(x), n, nthreads, out ) ;
+        case REALSXP:
+            return hashed_ids( internal::r_vector_start<REALSXP>(x), n, nthreads, out ) ;
+        case STRSXP:
+            return hashed_ids( internal::r_vector_start<STRSXP>(x), n, nthreads, out ) ;
+        default:
+            break ;
+        }
+        throw not_compatible( "Cannot group by a key of type %s", Rf_type2char( TYPEOF(x) ) ) ;
+    }
+
+    // numbers the pairs ( ids[i], other[i] ), in order of first appearance
+    inline int combine_ids( int* ids, int groups, const int* other, int other_groups, R_xlen_t n, int nthreads ){
+        if( use_direct_table( static_cast<double>(groups) * other_groups, n ) ){
+            std::vector<int> slots( static_cast<size_t>(groups) * other_groups, -1 ) ;
+            int combined = 0 ;
+            for( R_xlen_t i=0; i<n; i++ ){
+                size_t s = static_cast<size_t>( ids[i] ) * other_groups + other[i] ;
+                if( slots[s] < 0 ) slots[s] = combined++ ;
+                ids[i] = slots[s] ;
+            }
+            return combined ;
+        }
+        std::vector<uint64_t> pairs( n ) ;
+        for( R_xlen_t i=0; i<n; i++ ){
+            pairs[i] = ( static_cast<uint64_t>( ids[i] ) << 32 ) | static_cast<uint32_t>( other[i] ) ;
+        }
+        return hashed_ids( pairs.data(), n, nthreads, ids ) ;
+    }
+
+    // the key of each group: element first[g] of x, or the level itself
+    // when x is a factor whose levels are the groups
+    inline SEXP key_column( SEXP x, const std::vector<R_xlen_t>& first, bool by_level ){
+        int ng = static_cast<int>( first.size() ) ;
+        Shield<SEXP> res( Rf_allocVector( TYPEOF(x), ng ) ) ;
+        if( by_level ){
+            int nlevels = Rf_length( Rf_getAttrib( x, R_LevelsSymbol ) ) ;
+            int* p = INTEGER(res) ;
+            for( int g=0; g<ng; g++ ) p[g] = g < nlevels ? g + 1 : NA_INTEGER ;
+        } else {
+            switch( TYPEOF(x) ){
+            case INTSXP: {
+                int* p = INTEGER(res) ; const int* src = INTEGER(x) ;
+                for( int g=0; g<ng; g++ ) p[g] = src[ first[g] ] ;
+                break ;
+            }
+            case LGLSXP: {
+                int* p = LOGICAL(res) ; const int* src = LOGICAL(x) ;
+                for( int g=0; g<ng; g++ ) p[g] = src[ first[g] ] ;
+                break ;
+            }
+            case REALSXP: {
+                double* p = REAL(res) ; const double* src = REAL(x) ;
+                for( int g=0; g<ng; g++ ) p[g] = src[ first[g] ] ;
+                break ;
+            }
+            default:
+                for( int g=0; g<ng; g++ ) SET_STRING_ELT( res, g, STRING_ELT( x, first[g] ) ) ;
+                break ;
+            }
+        }
+        Rf_copyMostAttrib( x, res ) ;
+        return res ;
+    }
+
+    struct SumState {
+        SumState() : sum(0.0), n(0), na(false) {}
+        long double sum ;
+        R_xlen_t n ;
+        bool na ;
+    } ;
+
+    template <typename STORAGE>
+    struct ExtremeState {
+        ExtremeState() : value(), seen(false), na(false) {}
+        STORAGE value ;
+        bool seen ;
+        bool na ;
+    } ;
+
+} // group_detail
+
+    /**
+     * Rows of one or more key vectors numbered by group, see group_by().
+     */
+    class GroupBy {
+    public:
+        GroupBy( SEXP keys_, int nthreads_ = 1 ) :
+            keys(keys_), n(0), ngroups(0), nthreads(nthreads_), by_level(false), ids(), first(), sizes()
+        {
+            bool multiple = TYPEOF(keys_) == VECSXP ;
+            int ncol = multiple ? Rf_length(keys_) : 1 ;
+            if( ncol == 0 ) throw std::range_error( "group_by needs at least one key" ) ;
+            SEXP key = multiple ? VECTOR_ELT(keys_, 0) : keys_ ;
+            n = Rf_xlength(key) ;
+            ids.resize( n ) ;
+            ngroups = group_detail::column_ids( key, nthreads, ids.data(), by_level ) ;
+            if( ncol > 1 ){
+                by_level = false ;
+                std::vector<int> other( n ) ;
+                for( int j=1; j<ncol; j++ ){
+                    key = VECTOR_ELT(keys_, j) ;
+                    if( Rf_xlength(key) != n ) throw std::range_error( "group_by keys must have the same length" ) ;
+                    bool ignored ;
+                    int k = group_detail::column_ids( key, nthreads, other.data(), ignored ) ;
+                    ngroups = group_detail::combine_ids( ids.data(), ngroups, other.data(), k, n, nthreads ) ;
+                }
+            }
+            first.assign( ngroups, -1 ) ;
+            sizes.assign( ngroups, 0 ) ;
+            for( R_xlen_t i=0; i<n; i++ ){
+                int g = ids[i] ;
+                if( first[g] < 0 ) first[g] = i ;
+                sizes[g]++ ;
+            }
+        }
+
+        /** number of groups */
+        inline int size() const { return ngroups ; }
+
+        /** 1 based group of each row */
+        IntegerVector group_ids() const {
+            IntegerVector res( no_init(n) ) ;
+            for( R_xlen_t i=0; i<n; i++ ) res[i] = ids[i] + 1 ;
+            return res ;
+        }
+
+        /**
+         * the key of each group: a vector like the key vector, or a data
+         * frame with one column per key
+         */
+        SEXP group_keys() const {
+            if( TYPEOF(keys) != VECSXP ) return group_detail::key_column( keys, first, by_level ) ;
+            int ncol = Rf_length(keys) ;
+            List res( ncol ) ;
+            for( int j=0; j<ncol; j++ ){
+                res[j] = group_detail::key_column( VECTOR_ELT(keys, j), first, by_level ) ;
+            }
+            SEXP names = Rf_getAttrib( keys, R_NamesSymbol ) ;
+            if( ! Rf_isNull(names) ) res.attr( "names" ) = names ;
+            res.attr( "row.names" ) = IntegerVector::create( NA_INTEGER, -ngroups ) ;
+            res.attr( "class" ) = "data.frame" ;
+            return res ;
+        }
+
+        /** number of rows in each group */
+        IntegerVector count() const {
+            IntegerVector res( no_init(ngroups) ) ;
+            for( int g=0; g<ngroups; g++ ) res[g] = static_cast<int>( sizes[g] ) ;
+            return res ;
+        }
+
+        template <int RTYPE, bool NA, typename T>
+        NumericVector sum( const VectorBase<RTYPE,NA,T>& x, bool na_rm = false ) const {
+            std::vector<group_detail::SumState> s = sums( x, na_rm ) ;
+            NumericVector res( no_init(ngroups) ) ;
+            for( int g=0; g<ngroups; g++ ){
+                res[g] = ( sizes[g] == 0 || s[g].na ) ? NA_REAL : static_cast<double>( s[g].sum ) ;
+            }
+            return res ;
+        }
+
+        template <int RTYPE, bool NA, typename T>
+        NumericVector mean( const VectorBase<RTYPE,NA,T>& x, bool na_rm = false ) const {
+            std::vector<group_detail::SumState> s = sums( x, na_rm ) ;
+            NumericVector res( no_init(ngroups) ) ;
+            for( int g=0; g<ngroups; g++ ){
+                if( sizes[g] == 0 || s[g].na ){
+                    res[g] = NA_REAL ;
+                } else {
+                    res[g] = s[g].n == 0 ? R_NaN : static_cast<double>( s[g].sum / s[g].n ) ;
+                }
+            }
+            return res ;
+        }
+
+        template <int RTYPE, bool NA, typename T>
+        Vector<RTYPE> min( const VectorBase<RTYPE,NA,T>& x, bool na_rm = false ) const {
+            return extreme<false>( x, na_rm ) ;
+        }
+
+        template <int RTYPE, bool NA, typename T>
+        Vector<RTYPE> max( const VectorBase<RTYPE,NA,T>& x, bool na_rm = false ) const {
+            return extreme<true>( x, na_rm ) ;
+        }
+
+    private:
+
+        // Calls update( state[g], i ) for each row i of group g. With
+        // several threads, each one updates its own states for its rows,
+        // which are then merged. That only pays when there are few
+        // groups compared to rows.
+        template <typename State, typename Update, typename Merge>
+        std::vector<State> aggregate( R_xlen_t size, Update update, Merge merge ) const {
+            if( size != n ){
+                throw std::range_error( "group_by: the vector must have as many elements as the keys" ) ;
+            }
+            int nt = internal::parallel_threads( n, nthreads, RCPP_HASH_GRAIN ) ;
+            if( static_cast<double>(ngroups) * nt > static_cast<double>(n) ) nt = 1 ;
+            std::vector<R_xlen_t> bounds = internal::parallel_bounds( n, nt, RCPP_HASH_GRAIN ) ;
+            nt = static_cast<int>( bounds.size() ) - 1 ;
+            std::vector< std::vector<State> > partial( nt, std::vector<State>( ngroups ) ) ;
+            const int* g = ids.data() ;
+            internal::parallel_ranges( bounds, [&]( R_xlen_t begin, R_xlen_t end ){
+                size_t t = std::lower_bound( bounds.begin(), bounds.end(), begin ) - bounds.begin() ;
+                State* state = partial[t].data() ;
+                for( R_xlen_t i=begin; i<end; i++ ) update( state[ g[i] ], i ) ;
+            }) ;
+            for( int t=1; t<nt; t++ ){
+                for( int k=0; k<ngroups; k++ ) merge( partial[0][k], partial[t][k] ) ;
+            }
+            return partial[0] ;
+        }
+
+        template <int RTYPE, bool NA, typename T>
+        std::vector<group_detail::SumState> sums( const VectorBase<RTYPE,NA,T>& x, bool na_rm ) const {
+            typedef typename traits::storage_type<RTYPE>::type STORAGE ;
+            typedef group_detail::SumState State ;
+            std::vector<STORAGE> buffer ;
+            const STORAGE* v = map_input( x, buffer ) ;
+            return aggregate<State>( x.size(),
+                [v, na_rm]( State& s, R_xlen_t i ){
+                    STORAGE value = v[i] ;
+                    if( traits::is_na<RTYPE>( value ) ){
+                        if( ! na_rm ) s.na = true ;
+                    } else {
+                        s.sum += value ;
+                        s.n++ ;
+                    }
+                },
+                []( State& a, const State& b ){
+                    a.sum += b.sum ;
+                    a.n += b.n ;
+                    a.na = a.na || b.na ;
+                } ) ;
+        }
+
+        template <bool MAX, int RTYPE, bool NA, typename T>
+        Vector<RTYPE> extreme( const VectorBase<RTYPE,NA,T>& x, bool na_rm ) const {
+            typedef typename traits::storage_type<RTYPE>::type STORAGE ;
+            typedef group_detail::ExtremeState<STORAGE> State ;
+            std::vector<STORAGE> buffer ;
+            const STORAGE* v = map_input( x, buffer ) ;
+            std::vector<State> s = aggregate<State>( x.size(),
+                [v, na_rm]( State& state, R_xlen_t i ){
+                    STORAGE value = v[i] ;
+                    if( traits::is_na<RTYPE>( value ) ){
+                        if( ! na_rm ) state.na = true ;
+                    } else if( ! state.seen || ( MAX ? value > state.value : value < state.value ) ){
+                        state.value = value ;
+                        state.seen = true ;
+                    }
+                },
+                []( State& a, const State& b ){
+                    if( b.seen && ( ! a.seen || ( MAX ? b.value > a.value : b.value < a.value ) ) ){
+                        a.value = b.value ;
+                        a.seen = true ;
+                    }
+                    a.na = a.na || b.na ;
+                } ) ;
+            Vector<RTYPE> res( no_init(ngroups) ) ;
+            for( int g=0; g<ngroups; g++ ){
+                res[g] = ( s[g].na || ! s[g].seen ) ? traits::get_na<RTYPE>() : s[g].value ;
+            }
+            return res ;
+        }
+
+        RObject keys ;
+        R_xlen_t n ;
+        int ngroups ;
+        int nthreads ;
+        bool by_level ;
+        std::vector<int> ids ;
+        std::vector<R_xlen_t> first ;
+        std::vector<R_xlen_t> sizes ;
+    } ;
+
+} // sugar
+
+/**
+ * Groups the rows of keys, a vector or a list (or data frame) of key
+ * vectors of the same length, so that values can then be summarised by
+ * group in a single pass over them:
+ *
+ * // [[Rcpp::export]]
+ * List by_store( DataFrame sales ){
+ *     sugar::GroupBy g = group_by( DataFrame::create( sales["store"], sales["month"] ) ) ;
+ *     NumericVector amount = sales["amount"] ;
+ *     return List::create( g.group_keys(), g.sum( amount ), g.count() ) ;
+ * }
+ *
+ * Groups are numbered in the order in which they first appear, except
+ * when the only key is a factor: there is then one group per level, in
+ * the order of the levels, unused levels included. NA keys make a group
+ * of their own. Integer, logical and factor keys spanning a small range
+ * are numbered through a table of direct addresses, other keys through
+ * the hash tables of self_match().
+ *
+ * sum(), mean(), min() and max() of an empty group are NA, as is the
+ * result of a group holding NA or NaN unless na_rm is true. sum() and
+ * mean() return doubles. With nthreads greater than 1, keys are hashed
+ * in parallel, and when there are few groups compared to rows each
+ * thread reduces its share of the rows before the results are merged.
+ */
+inline sugar::GroupBy group_by( SEXP keys, int nthreads = 1 ){
+    return sugar::GroupBy( keys, nthreads ) ;
+}
+
+} // Rcpp
+
+#endif
@@ -0,0 +1,395 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// hash_join.h: Rcpp R/C++ interface class library -- joining data frames on keys
+//
+// Copyright (C) 2026  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp__sugar__hash_join_h
+#define Rcpp__sugar__hash_join_h
+
+// largest number of rows of the right table hashed into one table; the
+// rows are split into partitions of about that many on the high bits of
+// their hash, so that each table stays in cache while it is built and
+// probed
+#ifndef RCPP_JOIN_PARTITION_ROWS
+#define RCPP_JOIN_PARTITION_ROWS 16384
+#endif
+
+namespace Rcpp{
+namespace sugar{
+namespace join_detail{
+
+    // one key column, as ints (integer and logical), doubles or CHARSXP
+    struct KeyColumn {
+        int type ;
+        const void* data ;
+
+        inline uint64_t hash( R_xlen_t i ) const {
+            switch( type ){
+            case INTSXP:  return hash_detail::hash( static_cast<const int*>(data)[i] ) ;
+            case REALSXP: return hash_detail::hash( hash_detail::normalize( static_cast<const double*>(data)[i] ) ) ;
+            default:      return hash_detail::hash( static_cast<const SEXP*>(data)[i] ) ;
+            }
+        }
+
+        inline bool equal( R_xlen_t i, const KeyColumn& other, R_xlen_t j ) const {
+            switch( type ){
+            case INTSXP:
+                return static_cast<const int*>(data)[i] == static_cast<const int*>(other.data)[j] ;
+            case REALSXP:
+                return hash_detail::equal( hash_detail::normalize( static_cast<const double*>(data)[i] ),
+                                           hash_detail::normalize( static_cast<const double*>(other.data)[j] ) ) ;
+            default:
+                return static_cast<const SEXP*>(data)[i] == static_cast<const SEXP*>(other.data)[j] ;
+            }
+        }
+    } ;
+
+    // the key columns of one side of the join
+    class JoinKeys {
+    public:
+        JoinKeys() : columns(), n(0) {}
+
+        inline uint64_t hash( R_xlen_t i ) const {
+            uint64_t h = 0 ;
+            for( size_t k=0; k<columns.size(); k++ ){
+                h = hash_detail::mix( h ^ ( columns[k].hash(i) + 0x9e3779b97f4a7c15ULL + ( h << 6 ) + ( h >> 2 ) ) ) ;
+            }
+            return h ;
+        }
+
+        inline bool equal( R_xlen_t i, const JoinKeys& other, R_xlen_t j ) const {
+            for( size_t k=0; k<columns.size(); k++ ){
+                if( ! columns[k].equal( i, other.columns[k], j ) ) return false ;
+            }
+            return true ;
+        }
+
+        std::vector<KeyColumn> columns ;
+        R_xlen_t n ;
+    } ;
+
+    inline SEXP join_column( SEXP df, const char* name ){
+        SEXP names = Rf_getAttrib( df, R_NamesSymbol ) ;
+        R_xlen_t n = Rf_xlength(df) ;
+        for( R_xlen_t i=0; i<n && ! Rf_isNull(names); i++ ){
+            if( ! std::strcmp( CHAR( STRING_ELT(names, i) ), name ) ) return VECTOR_ELT( df, i ) ;
+        }
+        throw index_out_of_bounds( "No join column named '%s'", name ) ;
+    }
+
+    inline int key_type( SEXP x ){
+        switch( TYPEOF(x) ){
+        case INTSXP: case LGLSXP: return INTSXP ;
+        case REALSXP: return REALSXP ;
+        case STRSXP: return STRSXP ;
+        default: return NILSXP ;
+        }
+    }
+
+    inline KeyColumn key_column( SEXP x, int type ){
+        KeyColumn res ;
+        res.type = type ;
+        switch( TYPEOF(x) ){
+        case INTSXP:  res.data = internal::r_vector_start<INTSXP>(x) ; break ;
+        case LGLSXP:  res.data = internal::r_vector_start<LGLSXP>(x) ; break ;
+        case REALSXP: res.data = internal::r_vector_start<REALSXP>(x) ; break ;
+        default:      res.data = internal::r_vector_start<STRSXP>(x) ; break ;
+        }
+        return res ;
+    }
+
+    // Factors are joined on their labels and integers on doubles as
+    // doubles. The converted vectors are kept alive in keep.
+    inline void add_key( SEXP x, SEXP y, const char* name, List& keep, JoinKeys& left, JoinKeys& right ){
+        if( Rf_isFactor(x) ){ x = Rf_asCharacterFactor(x) ; keep.push_back(x) ; }
+        if( Rf_isFactor(y) ){ y = Rf_asCharacterFactor(y) ; keep.push_back(y) ; }
+        int tx = key_type(x), ty = key_type(y) ;
+        if( tx == NILSXP || ty == NILSXP || ( tx == STRSXP ) != ( ty == STRSXP ) ){
+            throw not_compatible( "Cannot join column '%s' of type %s with type %s", name,
+                Rf_type2char( TYPEOF(x) ), Rf_type2char( TYPEOF(y) ) ) ;
+        }
+        if( tx != ty ){
+            if( tx != REALSXP ){ x = Rf_coerceVector( x, REALSXP ) ; keep.push_back(x) ; }
+            if( ty != REALSXP ){ y = Rf_coerceVector( y, REALSXP ) ; keep.push_back(y) ; }
+            tx = ty = REALSXP ;
+        }
+        left.columns.push_back( key_column( x, tx ) ) ;
+        right.columns.push_back( key_column( y, ty ) ) ;
+    }
+
+    // The rows of the right table sharing a key are chained in order:
+    // head[j] is the first of them for every row j of the chain, next[j]
+    // the following one (-1 at the end), size[h] the length of the chain
+    // of head h. Each partition has its own open addressing table of
+    // chain heads.
+    class JoinTable {
+    public:
+        JoinTable( const JoinKeys& keys_, int nthreads_ ) :
+            keys(keys_), n(keys_.n), nthreads(nthreads_), bits(0),
+            hashes(), next(), size(), slots(), slot_start(), masks()
+        {
+            while( ( n >> bits ) > RCPP_JOIN_PARTITION_ROWS ) bits++ ;
+            hashes.resize( n ) ;
+            const JoinKeys& k = keys ;
+            uint64_t* h = hashes.data() ;
+            internal::parallel_for( n, nthreads, [&k, h]( R_xlen_t begin, R_xlen_t end ){
+                for( R_xlen_t j=begin; j<end; j++ ) h[j] = k.hash(j) ;
+            }, RCPP_HASH_GRAIN ) ;
+            build() ;
+        }
+
+        inline int partitions() const { return 1 << bits ; }
+        inline int partition( uint64_t h ) const { return bits == 0 ? 0 : static_cast<int>( h >> ( 64 - bits ) ) ; }
+
+        // first row of the right table with the key of row i of probe, -1 if none
+        inline int find( const JoinKeys& probe, R_xlen_t i, uint64_t h ) const {
+            int p = partition(h) ;
+            const int* table = &slots[ slot_start[p] ] ;
+            uint64_t mask = masks[p] ;
+            uint64_t addr = h & mask ;
+            while( table[addr] ){
+                int j = table[addr] - 1 ;
+                if( hashes[j] == h && keys.equal( j, probe, i ) ) return j ;
+                addr = ( addr + 1 ) & mask ;
+            }
+            return -1 ;
+        }
+
+        inline int chain_size( int j ) const { return size[j] ; }
+        inline int chain_next( int j ) const { return next[j] ; }
+
+        // positions 0..n-1 sorted by partition of hash, stably; starts
+        // gets the first position of each partition
+        static void partition_rows( const std::vector<uint64_t>& h, int bits, std::vector<int>& order, std::vector<R_xlen_t>& starts ){
+            R_xlen_t n = static_cast<R_xlen_t>( h.size() ) ;
+            int np = 1 << bits ;
+            starts.assign( np + 1, 0 ) ;
+            order.resize( n ) ;
+            if( bits == 0 ){
+                for( R_xlen_t i=0; i<n; i++ ) order[i] = static_cast<int>(i) ;
+                starts[1] = n ;
+                return ;
+            }
+            for( R_xlen_t i=0; i<n; i++ ) starts[ ( h[i] >> ( 64 - bits ) ) + 1 ]++ ;
+            for( int p=0; p<np; p++ ) starts[p+1] += starts[p] ;
+            std::vector<R_xlen_t> offsets( starts.begin(), starts.end() - 1 ) ;
+            for( R_xlen_t i=0; i<n; i++ ) order[ offsets[ h[i] >> ( 64 - bits ) ]++ ] = static_cast<int>(i) ;
+        }
+
+        // groups of consecutive partitions of similar sizes, one per thread
+        static std::vector<R_xlen_t> partition_bounds( const std::vector<R_xlen_t>& starts, int nthreads ){
+            int np = static_cast<int>( starts.size() ) - 1 ;
+            R_xlen_t n = starts[np] ;
+            int nt = std::min( internal::parallel_threads( n, nthreads, RCPP_HASH_GRAIN ), np ) ;
+            std::vector<R_xlen_t> bounds( 1, 0 ) ;
+            for( int p=1; p<np; p++ ){
+                if( starts[p] - starts[ bounds.back() ] >= n / nt && static_cast<int>( bounds.size() ) < nt ){
+                    bounds.push_back( p ) ;
+                }
+            }
+            bounds.push_back( np ) ;
+            return bounds ;
+        }
+
+    private:
+
+        void build(){
+            int np = partitions() ;
+            std::vector<int> order ;
+            std::vector<R_xlen_t> starts ;
+            partition_rows( hashes, bits, order, starts ) ;
+
+            slot_start.resize( np + 1 ) ;
+            masks.resize( np ) ;
+            slot_start[0] = 0 ;
+            for( int p=0; p<np; p++ ){
+                uint64_t m = 2 ;
+                while( m < static_cast<uint64_t>( starts[p+1] - starts[p] ) * 2 ) m *= 2 ;
+                masks[p] = m - 1 ;
+                slot_start[p+1] = slot_start[p] + static_cast<R_xlen_t>(m) ;
+            }
+            slots.assign( slot_start[np], 0 ) ;
+            next.assign( n, -1 ) ;
+            size.assign( n, 0 ) ;
+
+            // partitions are independent, so they can be built concurrently
+            std::vector<int> tail( n ) ;
+            internal::parallel_ranges( partition_bounds( starts, nthreads ), [&]( R_xlen_t first, R_xlen_t last ){
+                for( R_xlen_t p=first; p<last; p++ ){
+                    int* table = &slots[ slot_start[p] ] ;
+                    uint64_t mask = masks[p] ;
+                    for( R_xlen_t k=starts[p]; k<starts[p+1]; k++ ){
+                        int j = order[k] ;
+                        uint64_t h = hashes[j] ;
+                        uint64_t addr = h & mask ;
+                        for( ;; ){
+                            if( ! table[addr] ){
+                                table[addr] = j + 1 ;
+                                tail[j] = j ;
+                                size[j] = 1 ;
+                                break ;
+                            }
+                            int head = table[addr] - 1 ;
+                            if( hashes[head] == h && keys.equal( head, keys, j ) ){
+                                next[ tail[head] ] = j ;
+                                tail[head] = j ;
+                                size[head]++ ;
+                                break ;
+                            }
+                            addr = ( addr + 1 ) & mask ;
+                        }
+                    }
+                }
+            }) ;
+        }
+
+        const JoinKeys& keys ;
+        R_xlen_t n ;
+        int nthreads ;
+        int bits ;
+        std::vector<uint64_t> hashes ;
+        std::vector<int> next ;
+        std::vector<int> size ;
+        std::vector<int> slots ;
+        std::vector<R_xlen_t> slot_start ;
+        std::vector<uint64_t> masks ;
+    } ;
+
+    // head[i] = first row of the right table matching row i of probe, or
+    // -1. Rows are probed partition by partition, so that the lookups of
+    // a thread stay within one cache resident table at a time.
+    inline void probe_rows( const JoinTable& table, const JoinKeys& probe, int nthreads, int* head ){
+        R_xlen_t n = probe.n ;
+        std::vector<uint64_t> hashes( n ) ;
+        uint64_t* h = hashes.data() ;
+        internal::parallel_for( n, nthreads, [&probe, h]( R_xlen_t begin, R_xlen_t end ){
+            for( R_xlen_t i=begin; i<end; i++ ) h[i] = probe.hash(i) ;
+        }, RCPP_HASH_GRAIN ) ;
+
+        int bits = 0 ;
+        while( ( 1 << bits ) < table.partitions() ) bits++ ;
+        std::vector<int> order ;
+        std::vector<R_xlen_t> starts ;
+        JoinTable::partition_rows( hashes, bits, order, starts ) ;
+        const int* o = order.data() ;
+        const R_xlen_t* s = starts.data() ;
+        internal::parallel_ranges( JoinTable::partition_bounds( starts, nthreads ), [&table, &probe, h, o, s, head]( R_xlen_t first, R_xlen_t last ){
+            for( R_xlen_t k=s[first]; k<s[last]; k++ ){
+                int i = o[k] ;
+                head[i] = table.find( probe, i, h[i] ) ;
+            }
+        }) ;
+    }
+
+} // join_detail
+} // sugar
+
+/**
+ * Matches the rows of the data frames (or lists of columns) left and
+ * right on the columns named by, giving the 1 based row numbers of the
+ * result of the join as a list:
+ *
+ *   "inner"  left and right: every pair of rows with equal keys
+ *   "left"   same, plus the rows of left that match nothing, with NA
+ *            as their right row
+ *   "semi"   left only: the rows of left that match some row of right
+ *   "anti"   left only: the rows of left that match no row of right
+ *
+ * Pairs come in the order of the rows of left, then of right, as with
+ * merge( sort = FALSE ). Keys are compared without pasting them: strings
+ * by their cached CHARSXP, factors by their labels, integers and doubles
+ * as doubles; NA keys match NA keys.
+ *
+ * The rows of right are hashed into partitions small enough for their
+ * table to stay in cache, the rows of left then looked up partition by
+ * partition. With nthreads greater than 1, hashing, building the
+ * partitions and looking up rows are split over threads.
+ */
+inline List hash_join( const List& left, const List& right, const CharacterVector& by,
+                       const char* type = "inner", int nthreads = 1 ){
+    std::string how( type ) ;
+    bool keep_pairs = how == "inner" || how == "left" ;
+    if( ! keep_pairs && how != "semi" && how != "anti" ){
+        stop( "Invalid join type '%s'!", type ) ;
+    }
+    if( by.size() == 0 ) stop( "hash_join needs at least one key column" ) ;
+
+    sugar::join_detail::JoinKeys lkeys, rkeys ;
+    List keep ;
+    for( R_xlen_t k=0; k<by.size(); k++ ){
+        const char* name = CHAR( STRING_ELT( by, k ) ) ;
+        SEXP x = sugar::join_detail::join_column( left, name ) ;
+        SEXP y = sugar::join_detail::join_column( right, name ) ;
+        if( k == 0 ){
+            lkeys.n = Rf_xlength(x) ;
+            rkeys.n = Rf_xlength(y) ;
+        } else if( Rf_xlength(x) != lkeys.n || Rf_xlength(y) != rkeys.n ){
+            stop( "Key columns of a table must have the same length" ) ;
+        }
+        sugar::join_detail::add_key( x, y, name, keep, lkeys, rkeys ) ;
+    }
+
+    R_xlen_t n = lkeys.n ;
+    std::vector<int> head( n ) ;
+    {
+        sugar::join_detail::JoinTable table( rkeys, nthreads ) ;
+        sugar::join_detail::probe_rows( table, lkeys, nthreads, head.data() ) ;
+
+        if( keep_pairs ){
+            bool outer = how == "left" ;
+            R_xlen_t total = 0 ;
+            for( R_xlen_t i=0; i<n; i++ ){
+                total += head[i] >= 0 ? table.chain_size( head[i] ) : ( outer ? 1 : 0 ) ;
+            }
+            IntegerVector lrows( no_init(total) ), rrows( no_init(total) ) ;
+            int* pl = lrows.begin() ;
+            int* pr = rrows.begin() ;
+            R_xlen_t k = 0 ;
+            for( R_xlen_t i=0; i<n; i++ ){
+                if( head[i] < 0 ){
+                    if( outer ){
+                        pl[k] = static_cast<int>(i) + 1 ;
+                        pr[k++] = NA_INTEGER ;
+                    }
+                    continue ;
+                }
+                for( int j=head[i]; j>=0; j=table.chain_next(j) ){
+                    pl[k] = static_cast<int>(i) + 1 ;
+                    pr[k++] = j + 1 ;
+                }
+            }
+            return List::create( _["left"] = lrows, _["right"] = rrows ) ;
+        }
+    }
+
+    bool matched = how == "semi" ;
+    R_xlen_t total = 0 ;
+    for( R_xlen_t i=0; i<n; i++ ) total += ( head[i] >= 0 ) == matched ;
+    IntegerVector lrows( no_init(total) ) ;
+    int* pl = lrows.begin() ;
+    R_xlen_t k = 0 ;
+    for( R_xlen_t i=0; i<n; i++ ){
+        if( ( head[i] >= 0 ) == matched ) pl[k++] = static_cast<int>(i) + 1 ;
+    }
+    return List::create( _["left"] = lrows ) ;
+}
+
+} // Rcpp
+
+#endif
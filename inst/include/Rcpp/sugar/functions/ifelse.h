@@ -41,6 +41,7 @@ public:
 	typedef Rcpp::VectorBase<RTYPE ,LHS_NA ,LHS_T>  LHS_TYPE ;
 	typedef Rcpp::VectorBase<RTYPE ,RHS_NA ,RHS_T>  RHS_TYPE ;
 	typedef typename traits::storage_type<RTYPE>::type STORAGE ;
+	typedef typename kernels::all_direct<COND_T,LHS_T,RHS_T>::type r_fill_kernel ;
 
 	// typedef typename Rcpp::traits::Extractor<RTYPE ,LHS_NA ,LHS_T>::type  LHS_EXT ;
 	// typedef typename Rcpp::traits::Extractor<RTYPE ,RHS_NA ,RHS_T>::type  RHS_EXT ;
@@ -61,6 +62,17 @@ public:
 
 	inline R_xlen_t size() const { return cond.size() ; }
 
+	// writes all the elements at once, out may be one of the operands
+	inline void fill( STORAGE* out ) const {
+		kernels::Operand<int,COND_T> c( cond.get_ref() ) ;
+		kernels::Operand<STORAGE,LHS_T> l( lhs ) ;
+		kernels::Operand<STORAGE,RHS_T> r( rhs ) ;
+		kernels::apply( c, l, r, size(), out, kernels::SelectKernel<STORAGE>( Rcpp::traits::get_na<RTYPE>() ) ) ;
+	}
+
+	template <typename Iterator>
+	inline void fill( Iterator out ) const { kernels::fill_elements( *this, out ) ; }
+
 private:
 	const COND_TYPE& cond ;
 	const LHS_T& lhs ;
@@ -87,6 +99,7 @@ public:
 
 	typedef typename Rcpp::traits::Extractor<RTYPE ,LHS_NA ,LHS_T>::type  LHS_EXT ;
 	typedef typename Rcpp::traits::Extractor<RTYPE ,RHS_NA ,RHS_T>::type  RHS_EXT ;
+	typedef typename kernels::all_direct<COND_T,LHS_EXT,RHS_EXT>::type r_fill_kernel ;
 
 	IfElse( const COND_TYPE& cond_, const LHS_TYPE& lhs_, const RHS_TYPE& rhs_ ) :
 		cond(cond_), lhs(lhs_.get_ref()), rhs(rhs_.get_ref()) {
@@ -100,6 +113,17 @@ public:
 
 	inline R_xlen_t size() const { return cond.size() ; }
 
+	// writes all the elements at once, out may be one of the operands
+	inline void fill( STORAGE* out ) const {
+		kernels::Operand<int,COND_T> c( cond.get_ref() ) ;
+		kernels::Operand<STORAGE,LHS_EXT> l( lhs ) ;
+		kernels::Operand<STORAGE,RHS_EXT> r( rhs ) ;
+		kernels::apply( c, l, r, size(), out, kernels::SelectKernel<STORAGE>( Rcpp::traits::get_na<RTYPE>() ) ) ;
+	}
+
+	template <typename Iterator>
+	inline void fill( Iterator out ) const { kernels::fill_elements( *this, out ) ; }
+
 private:
 
 	const COND_TYPE& cond ;
@@ -127,6 +151,7 @@ public:
 	typedef typename traits::storage_type<RTYPE>::type STORAGE ;
 
 	typedef typename Rcpp::traits::Extractor<RTYPE ,RHS_NA ,RHS_T>::type  RHS_EXT ;
+	typedef typename kernels::all_direct<COND_T,RHS_EXT>::type r_fill_kernel ;
 
 	IfElse_Primitive_Vector( const COND_TYPE& cond_, STORAGE lhs_, const RHS_TYPE& rhs_ ) :
 		cond(cond_), lhs(lhs_), rhs(rhs_.get_ref()) {
@@ -135,13 +160,24 @@ public:
 
 	inline STORAGE operator[]( R_xlen_t i ) const {
 		int x = cond[i] ;
-		if( Rcpp::traits::is_na<LGLSXP>(x) ) return x ;
+		if( Rcpp::traits::is_na<LGLSXP>(x) ) return Rcpp::traits::get_na<RTYPE>() ;
 		if( x ) return lhs ;
 		return rhs[i] ;
 	}
 
 	inline R_xlen_t size() const { return cond.size() ; }
 
+	// writes all the elements at once, out may be one of the operands
+	inline void fill( STORAGE* out ) const {
+		kernels::Operand<int,COND_T> c( cond.get_ref() ) ;
+		kernels::Operand< STORAGE,kernels::Constant<STORAGE> > l( lhs ) ;
+		kernels::Operand<STORAGE,RHS_EXT> r( rhs ) ;
+		kernels::apply( c, l, r, size(), out, kernels::SelectKernel<STORAGE>( Rcpp::traits::get_na<RTYPE>() ) ) ;
+	}
+
+	template <typename Iterator>
+	inline void fill( Iterator out ) const { kernels::fill_elements( *this, out ) ; }
+
 private:
 	const COND_TYPE& cond ;
 	STORAGE lhs ;
@@ -164,6 +200,7 @@ public:
 	typedef Rcpp::VectorBase<RTYPE ,RHS_NA ,RHS_T>  RHS_TYPE ;
 	typedef typename traits::storage_type<RTYPE>::type STORAGE ;
 	typedef typename Rcpp::traits::Extractor<RTYPE ,RHS_NA ,RHS_T>::type  RHS_EXT ;
+	typedef typename kernels::all_direct<COND_T,RHS_EXT>::type r_fill_kernel ;
 
 	IfElse_Primitive_Vector( const COND_TYPE& cond_, STORAGE lhs_, const RHS_TYPE& rhs_ ) :
 		cond(cond_), lhs(lhs_), rhs(rhs_.get_ref()) {
@@ -177,6 +214,17 @@ public:
 
 	inline R_xlen_t size() const { return cond.size() ; }
 
+	// writes all the elements at once, out may be one of the operands
+	inline void fill( STORAGE* out ) const {
+		kernels::Operand<int,COND_T> c( cond.get_ref() ) ;
+		kernels::Operand< STORAGE,kernels::Constant<STORAGE> > l( lhs ) ;
+		kernels::Operand<STORAGE,RHS_EXT> r( rhs ) ;
+		kernels::apply( c, l, r, size(), out, kernels::SelectKernel<STORAGE>( Rcpp::traits::get_na<RTYPE>() ) ) ;
+	}
+
+	template <typename Iterator>
+	inline void fill( Iterator out ) const { kernels::fill_elements( *this, out ) ; }
+
 private:
 	const COND_TYPE& cond ;
 	STORAGE lhs ;
@@ -203,6 +251,7 @@ public:
 	typedef Rcpp::VectorBase<RTYPE ,LHS_NA ,LHS_T>  LHS_TYPE ;
 	typedef typename traits::storage_type<RTYPE>::type STORAGE ;
 	typedef typename Rcpp::traits::Extractor<RTYPE ,LHS_NA ,LHS_T>::type  LHS_EXT ;
+	typedef typename kernels::all_direct<COND_T,LHS_EXT>::type r_fill_kernel ;
 
 	IfElse_Vector_Primitive( const COND_TYPE& cond_, const LHS_TYPE& lhs_, STORAGE rhs_ ) :
 		cond(cond_), lhs(lhs_.get_ref()), rhs(rhs_) {
@@ -218,6 +267,17 @@ public:
 
 	inline R_xlen_t size() const { return cond.size() ; }
 
+	// writes all the elements at once, out may be one of the operands
+	inline void fill( STORAGE* out ) const {
+		kernels::Operand<int,COND_T> c( cond.get_ref() ) ;
+		kernels::Operand<STORAGE,LHS_EXT> l( lhs ) ;
+		kernels::Operand< STORAGE,kernels::Constant<STORAGE> > r( rhs ) ;
+		kernels::apply( c, l, r, size(), out, kernels::SelectKernel<STORAGE>( Rcpp::traits::get_na<RTYPE>() ) ) ;
+	}
+
+	template <typename Iterator>
+	inline void fill( Iterator out ) const { kernels::fill_elements( *this, out ) ; }
+
 private:
 	const COND_TYPE& cond ;
 	const LHS_EXT& lhs ;
@@ -240,6 +300,7 @@ public:
 	typedef Rcpp::VectorBase<RTYPE ,LHS_NA ,LHS_T>  LHS_TYPE ;
 	typedef typename traits::storage_type<RTYPE>::type STORAGE ;
 	typedef typename Rcpp::traits::Extractor<RTYPE ,LHS_NA ,LHS_T>::type  LHS_EXT ;
+	typedef typename kernels::all_direct<COND_T,LHS_EXT>::type r_fill_kernel ;
 
 	IfElse_Vector_Primitive( const COND_TYPE& cond_, const LHS_TYPE& lhs_, STORAGE rhs_ ) :
 		cond(cond_), lhs(lhs_.get_ref()), rhs(rhs_) {
@@ -253,6 +314,17 @@ public:
 
 	inline R_xlen_t size() const { return cond.size() ; }
 
+	// writes all the elements at once, out may be one of the operands
+	inline void fill( STORAGE* out ) const {
+		kernels::Operand<int,COND_T> c( cond.get_ref() ) ;
+		kernels::Operand<STORAGE,LHS_EXT> l( lhs ) ;
+		kernels::Operand< STORAGE,kernels::Constant<STORAGE> > r( rhs ) ;
+		kernels::apply( c, l, r, size(), out, kernels::SelectKernel<STORAGE>( Rcpp::traits::get_na<RTYPE>() ) ) ;
+	}
+
+	template <typename Iterator>
+	inline void fill( Iterator out ) const { kernels::fill_elements( *this, out ) ; }
+
 private:
 	const COND_TYPE& cond ;
 	const LHS_EXT& lhs ;
@@ -278,6 +350,7 @@ class IfElse_Primitive_Primitive : public VectorBase<
 public:
 	typedef Rcpp::VectorBase<LGLSXP,COND_NA,COND_T> COND_TYPE ;
 	typedef typename traits::storage_type<RTYPE>::type STORAGE ;
+	typedef typename kernels::all_direct<COND_T>::type r_fill_kernel ;
 
 	IfElse_Primitive_Primitive( const COND_TYPE& cond_, STORAGE lhs_, STORAGE rhs_ ) :
 		cond(cond_), lhs(lhs_), rhs(rhs_)  {
@@ -292,6 +365,17 @@ public:
 
 	inline R_xlen_t size() const { return cond.size() ; }
 
+	// writes all the elements at once, out may be one of the operands
+	inline void fill( STORAGE* out ) const {
+		kernels::Operand<int,COND_T> c( cond.get_ref() ) ;
+		kernels::Operand< STORAGE,kernels::Constant<STORAGE> > l( lhs ) ;
+		kernels::Operand< STORAGE,kernels::Constant<STORAGE> > r( rhs ) ;
+		kernels::apply( c, l, r, size(), out, kernels::SelectKernel<STORAGE>( Rcpp::traits::get_na<RTYPE>() ) ) ;
+	}
+
+	template <typename Iterator>
+	inline void fill( Iterator out ) const { kernels::fill_elements( *this, out ) ; }
+
 private:
 	const COND_TYPE& cond ;
 	STORAGE lhs ;
@@ -311,6 +395,7 @@ class IfElse_Primitive_Primitive<RTYPE,false,COND_T> : public VectorBase<
 public:
 	typedef Rcpp::VectorBase<LGLSXP,false,COND_T> COND_TYPE ;
 	typedef typename traits::storage_type<RTYPE>::type STORAGE ;
+	typedef typename kernels::all_direct<COND_T>::type r_fill_kernel ;
 
 	IfElse_Primitive_Primitive( const COND_TYPE& cond_, STORAGE lhs_, STORAGE rhs_ ) :
 		cond(cond_), lhs(lhs_), rhs(rhs_) {
@@ -323,6 +408,17 @@ public:
 
 	inline R_xlen_t size() const { return cond.size() ; }
 
+	// writes all the elements at once, out may be one of the operands
+	inline void fill( STORAGE* out ) const {
+		kernels::Operand<int,COND_T> c( cond.get_ref() ) ;
+		kernels::Operand< STORAGE,kernels::Constant<STORAGE> > l( lhs ) ;
+		kernels::Operand< STORAGE,kernels::Constant<STORAGE> > r( rhs ) ;
+		kernels::apply( c, l, r, size(), out, kernels::SelectKernel<STORAGE>( Rcpp::traits::get_na<RTYPE>() ) ) ;
+	}
+
+	template <typename Iterator>
+	inline void fill( Iterator out ) const { kernels::fill_elements( *this, out ) ; }
+
 private:
 	const COND_TYPE& cond ;
 	STORAGE lhs ;
@@ -0,0 +1,273 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// map.h: Rcpp R/C++ interface class library -- eager, typed sapply and mapply
+//
+// Copyright (C) 2026  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp__sugar__map_h
+#define Rcpp__sugar__map_h
+
+#include <tuple>
+
+// minimum number of elements per thread before vmap() splits its input
+#ifndef RCPP_MAP_GRAIN
+#define RCPP_MAP_GRAIN 16384
+#endif
+
+namespace Rcpp{
+namespace traits{
+
+    // results of these types make a data frame, one column per element
+    template <typename T> struct map_columns : public false_type {} ;
+    template <typename A, typename B> struct map_columns< std::pair<A,B> > : public true_type {} ;
+    template <typename... T> struct map_columns< std::tuple<T...> > : public true_type {} ;
+
+} // traits
+
+namespace sugar{
+
+    // writes the element I of tuples into column I of a data frame
+    template <typename Tuple, size_t I = 0, bool END = ( I == std::tuple_size<Tuple>::value ) >
+    struct MapColumns {
+        typedef typename traits::remove_const_and_reference<
+            typename std::tuple_element<I,Tuple>::type
+        >::type element_type ;
+        const static int RTYPE = traits::r_sexptype_traits<element_type>::rtype ;
+        typedef typename traits::r_vector_element_converter<RTYPE>::type converter_type ;
+        typedef typename traits::storage_type<RTYPE>::type STORAGE ;
+        typedef MapColumns<Tuple, I + 1> Next ;
+
+        const static bool thread_safe = traits::is_thread_safe_rtype<RTYPE>::value && Next::thread_safe ;
+
+        static void allocate( List& columns, std::vector<void*>& starts, R_xlen_t n ){
+            Vector<RTYPE> column( no_init(n) ) ;
+            columns[I] = column ;
+            starts[I] = traits::is_thread_safe_rtype<RTYPE>::value ? DATAPTR(column) : 0 ;
+            Next::allocate( columns, starts, n ) ;
+        }
+
+        static void set( const List& columns, const std::vector<void*>& starts, R_xlen_t i, const Tuple& value ){
+            set_element( columns, starts, i, std::get<I>(value),
+                typename traits::is_thread_safe_rtype<RTYPE>::type() ) ;
+            Next::set( columns, starts, i, value ) ;
+        }
+
+    private:
+        template <typename U>
+        static void set_element( const List&, const std::vector<void*>& starts, R_xlen_t i, const U& value, traits::true_type ){
+            static_cast<STORAGE*>( starts[I] )[i] = converter_type::get( value ) ;
+        }
+        template <typename U>
+        static void set_element( const List& columns, const std::vector<void*>&, R_xlen_t i, const U& value, traits::false_type ){
+            SEXP column = VECTOR_ELT( columns, I ) ;
+            if( RTYPE == STRSXP ){
+                SET_STRING_ELT( column, i, converter_type::get( value ) ) ;
+            } else {
+                SET_VECTOR_ELT( column, i, converter_type::get( value ) ) ;
+            }
+        }
+    } ;
+
+    template <typename Tuple, size_t I>
+    struct MapColumns<Tuple, I, true> {
+        const static bool thread_safe = true ;
+        static void allocate( List&, std::vector<void*>&, R_xlen_t ){}
+        static void set( const List&, const std::vector<void*>&, R_xlen_t, const Tuple& ){}
+    } ;
+
+    // where vmap() writes results of type R: one vector of the matching
+    // type, or a list of wrapped results when there is none
+    template <typename R, bool COLUMNS = traits::map_columns<R>::value >
+    struct MapOutput {
+        const static int RTYPE = traits::r_sexptype_traits<R>::rtype ;
+        typedef typename traits::r_vector_element_converter<RTYPE>::type converter_type ;
+        typedef Vector<RTYPE> type ;
+
+        const static bool thread_safe = traits::is_thread_safe_rtype<RTYPE>::value ;
+
+        template <typename Eval>
+        static type run( R_xlen_t n, int nthreads, Eval& eval ){
+            type res( no_init(n) ) ;
+            typename type::iterator out = res.begin() ;
+            internal::parallel_for( n, nthreads, [out, &eval]( R_xlen_t begin, R_xlen_t end ){
+                for( R_xlen_t i=begin; i<end; i++ ) out[i] = converter_type::get( eval(i) ) ;
+            }, RCPP_MAP_GRAIN ) ;
+            return res ;
+        }
+    } ;
+
+    // pairs and tuples: a data frame with columns V1, V2, ...
+    template <typename R>
+    struct MapOutput<R, true> {
+        typedef MapColumns<R> Columns ;
+        typedef DataFrame type ;
+
+        const static bool thread_safe = Columns::thread_safe ;
+
+        template <typename Eval>
+        static type run( R_xlen_t n, int nthreads, Eval& eval ){
+            const int k = std::tuple_size<R>::value ;
+            List columns( k ) ;
+            std::vector<void*> starts( k ) ;
+            Columns::allocate( columns, starts, n ) ;
+            const List& cols = columns ;
+            internal::parallel_for( n, nthreads, [&cols, &starts, &eval]( R_xlen_t begin, R_xlen_t end ){
+                for( R_xlen_t i=begin; i<end; i++ ) Columns::set( cols, starts, i, eval(i) ) ;
+            }, RCPP_MAP_GRAIN ) ;
+
+            CharacterVector names( k ) ;
+            char name[16] ;
+            for( int j=0; j<k; j++ ){
+                snprintf( name, sizeof(name), "V%d", j + 1 ) ;
+                names[j] = name ;
+            }
+            columns.attr( "names" ) = names ;
+            IntegerVector row_names = IntegerVector::create( NA_INTEGER, -static_cast<int>(n) ) ;
+            columns.attr( "row.names" ) = row_names ;
+            columns.attr( "class" ) = "data.frame" ;
+            return type( columns ) ;
+        }
+    } ;
+
+    // the elements of x in contiguous memory: those of the vector itself,
+    // or a copy of the values of an expression
+    template <int RTYPE, bool NA, typename T>
+    inline const typename traits::storage_type<RTYPE>::type* map_input(
+        const VectorBase<RTYPE,NA,T>& x, std::vector< typename traits::storage_type<RTYPE>::type >& buffer ){
+        const T& ref = x.get_ref() ;
+        R_xlen_t n = ref.size() ;
+        buffer.resize( n ) ;
+        for( R_xlen_t i=0; i<n; i++ ) buffer[i] = ref[i] ;
+        return buffer.empty() ? 0 : &buffer[0] ;
+    }
+    template <int RTYPE, template <class> class StoragePolicy>
+    inline const typename traits::storage_type<RTYPE>::type* map_input(
+        const VectorBase<RTYPE,true,Vector<RTYPE,StoragePolicy> >& x, std::vector< typename traits::storage_type<RTYPE>::type >& ){
+        return x.get_ref().begin() ;
+    }
+
+    template <typename Output, int RTYPE, bool NA, typename T, typename Function>
+    inline typename Output::type map_run( const VectorBase<RTYPE,NA,T>& x, Function& fun, int, traits::false_type ){
+        const T& ref = x.get_ref() ;
+        auto eval = [&ref, &fun]( R_xlen_t i ){ return fun( ref[i] ) ; } ;
+        return Output::run( ref.size(), 1, eval ) ;
+    }
+
+    template <typename Output, int RTYPE, bool NA, typename T, typename Function>
+    inline typename Output::type map_run( const VectorBase<RTYPE,NA,T>& x, Function& fun, int nthreads, traits::true_type ){
+        typedef typename traits::storage_type<RTYPE>::type STORAGE ;
+        R_xlen_t n = x.size() ;
+        int nt = internal::parallel_threads( n, nthreads, RCPP_MAP_GRAIN ) ;
+        if( nt == 1 ) return map_run<Output>( x, fun, 1, traits::false_type() ) ;
+        std::vector<STORAGE> buffer ;
+        const STORAGE* in = map_input( x, buffer ) ;
+        auto eval = [in, &fun]( R_xlen_t i ){ return fun( in[i] ) ; } ;
+        return Output::run( n, nt, eval ) ;
+    }
+
+    template <typename Output,
+              int RTYPE_1, bool NA_1, typename T_1,
+              int RTYPE_2, bool NA_2, typename T_2,
+              typename Function>
+    inline typename Output::type map_run( const VectorBase<RTYPE_1,NA_1,T_1>& x, const VectorBase<RTYPE_2,NA_2,T_2>& y,
+                                          Function& fun, int, traits::false_type ){
+        const T_1& ref_1 = x.get_ref() ;
+        const T_2& ref_2 = y.get_ref() ;
+        auto eval = [&ref_1, &ref_2, &fun]( R_xlen_t i ){ return fun( ref_1[i], ref_2[i] ) ; } ;
+        return Output::run( ref_1.size(), 1, eval ) ;
+    }
+
+    template <typename Output,
+              int RTYPE_1, bool NA_1, typename T_1,
+              int RTYPE_2, bool NA_2, typename T_2,
+              typename Function>
+    inline typename Output::type map_run( const VectorBase<RTYPE_1,NA_1,T_1>& x, const VectorBase<RTYPE_2,NA_2,T_2>& y,
+                                          Function& fun, int nthreads, traits::true_type ){
+        typedef typename traits::storage_type<RTYPE_1>::type STORAGE_1 ;
+        typedef typename traits::storage_type<RTYPE_2>::type STORAGE_2 ;
+        R_xlen_t n = x.size() ;
+        int nt = internal::parallel_threads( n, nthreads, RCPP_MAP_GRAIN ) ;
+        if( nt == 1 ) return map_run<Output>( x, y, fun, 1, traits::false_type() ) ;
+        std::vector<STORAGE_1> buffer_1 ;
+        std::vector<STORAGE_2> buffer_2 ;
+        const STORAGE_1* in_1 = map_input( x, buffer_1 ) ;
+        const STORAGE_2* in_2 = map_input( y, buffer_2 ) ;
+        auto eval = [in_1, in_2, &fun]( R_xlen_t i ){ return fun( in_1[i], in_2[i] ) ; } ;
+        return Output::run( n, nt, eval ) ;
+    }
+
+} // sugar
+
+    /**
+     * fun applied to each element of x, like sapply(), but computed at
+     * once into a single vector whose type follows from the type fun
+     * returns: a NumericVector for double, a LogicalVector for bool, a
+     * CharacterVector for std::string, and so on. A function returning a
+     * std::pair or a std::tuple makes a data frame with one column per
+     * element, named V1, V2, ... Results of any other type, for which R
+     * has no vector (an Rcpp::List, a std::vector, a SEXP, ...), are
+     * wrapped one by one into a list, as lapply() does.
+     *
+     * // [[Rcpp::export]]
+     * DataFrame polar( NumericVector angle ){
+     *     return vmap( angle, []( double a ){
+     *         return std::make_pair( std::cos(a), std::sin(a) ) ;
+     *     }, 4 ) ;
+     * }
+     *
+     * With nthreads greater than 1, x is split over as many threads when
+     * it is long enough. Asking for threads is a promise that fun does not
+     * use the R API and can be called concurrently; results and elements
+     * that are not plain numbers are always handled on the calling thread.
+     *
+     * vmap is not called map so that it cannot clash with std::map in
+     * code that uses both namespaces.
+     */
+    template <int RTYPE, bool NA, typename T, typename Function>
+    inline typename sugar::MapOutput<
+        typename traits::remove_const_and_reference< typename traits::result_of<Function, T>::type >::type
+    >::type
+    vmap( const VectorBase<RTYPE,NA,T>& x, Function fun, int nthreads = 1 ){
+        typedef typename traits::remove_const_and_reference< typename traits::result_of<Function, T>::type >::type result_type ;
+        typedef sugar::MapOutput<result_type> Output ;
+        const bool threads = Output::thread_safe && traits::is_thread_safe_rtype<RTYPE>::value ;
+        return sugar::map_run<Output>( x, fun, nthreads, typename traits::integral_constant<bool, threads>::type() ) ;
+    }
+
+    /**
+     * fun(x[i], y[i]) for each i, like mapply() over two vectors of the
+     * same length, with the results stored as in vmap().
+     */
+    template <int RTYPE_1, bool NA_1, typename T_1,
+              int RTYPE_2, bool NA_2, typename T_2,
+              typename Function>
+    inline typename sugar::MapOutput<
+        typename traits::remove_const_and_reference< typename traits::result_of<Function, T_1, T_2>::type >::type
+    >::type
+    vmap2( const VectorBase<RTYPE_1,NA_1,T_1>& x, const VectorBase<RTYPE_2,NA_2,T_2>& y, Function fun, int nthreads = 1 ){
+        if( x.size() != y.size() ) throw std::range_error( "vmap2 needs vectors of the same length" ) ;
+        typedef typename traits::remove_const_and_reference< typename traits::result_of<Function, T_1, T_2>::type >::type result_type ;
+        typedef sugar::MapOutput<result_type> Output ;
+        const bool threads = Output::thread_safe &&
+            traits::is_thread_safe_rtype<RTYPE_1>::value && traits::is_thread_safe_rtype<RTYPE_2>::value ;
+        return sugar::map_run<Output>( x, y, fun, nthreads, typename traits::integral_constant<bool, threads>::type() ) ;
+    }
+
+} // Rcpp
+
+#endif
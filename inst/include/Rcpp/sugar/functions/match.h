@@ -24,10 +24,42 @@
 
 namespace Rcpp{
 
+namespace sugar{
+
+template <int RTYPE, int OUT_RTYPE>
+inline Vector<OUT_RTYPE> match_impl( const Vector<RTYPE>& x, const Vector<RTYPE>& table, int nthreads ){
+    typedef typename traits::storage_type<RTYPE>::type STORAGE ;
+    typedef typename traits::storage_type<OUT_RTYPE>::type OUT ;
+    R_xlen_t n = x.size(), nt = table.size() ;
+    Vector<OUT_RTYPE> result = no_init(n) ;
+    hash_detail::match_positions<STORAGE,OUT> fun(
+        internal::r_vector_start<RTYPE>( x ), n, internal::r_vector_start<RTYPE>( table ), nt,
+        nthreads, result.begin(), traits::get_na<OUT_RTYPE>()
+    ) ;
+    hash_detail::dispatch_index( nt, fun ) ;
+    return result ;
+}
+
+} // sugar
+
+// 1 based position of the first match of each element of x in table,
+// NA when there is none. NA matches NA and NaN matches NaN, as in R.
+template <int RTYPE, bool NA, typename T, bool RHS_NA, typename RHS_T>
+inline IntegerVector match( const VectorBase<RTYPE,NA,T>& x, const VectorBase<RTYPE,RHS_NA,RHS_T>& table_, int nthreads = 1 ){
+    Vector<RTYPE> table = table_ ;
+    if( table.size() > INT_MAX ){
+        stop( "match(): the table is a long vector, use match_long()" ) ;
+    }
+    Vector<RTYPE> values = x ;
+    return sugar::match_impl<RTYPE,INTSXP>( values, table, nthreads ) ;
+}
+
+// same, with double positions so that the table can be a long vector
 template <int RTYPE, bool NA, typename T, bool RHS_NA, typename RHS_T>
-inline IntegerVector match( const VectorBase<RTYPE,NA,T>& x, const VectorBase<RTYPE,RHS_NA,RHS_T>& table_ ){
+inline NumericVector match_long( const VectorBase<RTYPE,NA,T>& x, const VectorBase<RTYPE,RHS_NA,RHS_T>& table_, int nthreads = 1 ){
     Vector<RTYPE> table = table_ ;
-    return sugar::IndexHash<RTYPE>( table ).fill().lookup( x.get_ref() ) ;
+    Vector<RTYPE> values = x ;
+    return sugar::match_impl<RTYPE,REALSXP>( values, table, nthreads ) ;
 }
 
 } // Rcpp
@@ -0,0 +1,95 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// order.h: Rcpp R/C++ interface class library -- order, sort_index
+//
+// Copyright (C) 2026  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp__sugar__order_h
+#define Rcpp__sugar__order_h
+
+namespace Rcpp{
+namespace sugar{
+namespace order_detail{
+
+    template <int RTYPE>
+    inline void fill_order( const Vector<RTYPE>& x, int* idx, bool decreasing, int nthreads ){
+        internal::radix_order( internal::r_vector_start<RTYPE>( x ), idx, x.size(), decreasing, nthreads ) ;
+    }
+
+    // no radix key for complex numbers: stable comparison sort with the
+    // values containing NA or NaN moved to the end
+    struct complex_less {
+        complex_less( const Rcomplex* x_, bool decreasing_ ) : x(x_), decreasing(decreasing_){}
+        inline bool operator()( int a, int b ) const {
+            return decreasing ? internal::NAComparator<Rcomplex>()( x[b], x[a] ) : internal::NAComparator<Rcomplex>()( x[a], x[b] ) ;
+        }
+        const Rcomplex* x ;
+        bool decreasing ;
+    } ;
+    struct complex_is_present {
+        complex_is_present( const Rcomplex* x_ ) : x(x_){}
+        inline bool operator()( int i ) const {
+            return ( x[i].r == x[i].r ) && ( x[i].i == x[i].i ) ;
+        }
+        const Rcomplex* x ;
+    } ;
+
+    template <>
+    inline void fill_order<CPLXSXP>( const Vector<CPLXSXP>& x, int* idx, bool decreasing, int /*nthreads*/ ){
+        const Rcomplex* p = internal::r_vector_start<CPLXSXP>( x ) ;
+        R_xlen_t n = x.size() ;
+        for( R_xlen_t i=0; i<n; i++ ) idx[i] = static_cast<int>(i) ;
+        int* last = std::stable_partition( idx, idx + n, complex_is_present( p ) ) ;
+        std::stable_sort( idx, last, complex_less( p, decreasing ) ) ;
+    }
+
+    template <int RTYPE, bool NA, typename T>
+    inline IntegerVector make_order( const VectorBase<RTYPE,NA,T>& x, bool decreasing, int nthreads, int offset ){
+        internal::Sort_is_not_allowed_for_this_type<RTYPE>::do_nothing() ;
+        Vector<RTYPE> vec( x.get_ref() ) ;
+        R_xlen_t n = vec.size() ;
+        if( n > INT_MAX ){
+            stop( "order() and sort_index() are limited to vectors of fewer than 2^31 elements" ) ;
+        }
+        IntegerVector res = no_init( n ) ;
+        fill_order<RTYPE>( vec, res.begin(), decreasing, nthreads ) ;
+        if( offset ){
+            for( R_xlen_t i=0; i<n; i++ ) res[i] += offset ;
+        }
+        return res ;
+    }
+
+} // order_detail
+} // sugar
+
+// 0 based positions of the elements of x in sorted order, so that
+// x[ sort_index(x) ] is sorted. Ties keep their original order and
+// missing values come last, NA before NaN, also when decreasing.
+template <int RTYPE, bool NA, typename T>
+inline IntegerVector sort_index( const VectorBase<RTYPE,NA,T>& x, bool decreasing = false, int nthreads = 1 ){
+    return sugar::order_detail::make_order( x, decreasing, nthreads, 0 ) ;
+}
+
+// same as sort_index() but 1 based, like order() in R
+template <int RTYPE, bool NA, typename T>
+inline IntegerVector order( const VectorBase<RTYPE,NA,T>& x, bool decreasing = false, int nthreads = 1 ){
+    return sugar::order_detail::make_order( x, decreasing, nthreads, 1 ) ;
+}
+
+} // Rcpp
+#endif
@@ -27,41 +27,23 @@ namespace sugar{
 
 template <int RTYPE, bool LHS_NA, bool RHS_NA> struct pmin_op ;
 
-// specializations for double.
-// we use the fact that NA < x is false
-template <>
-struct pmin_op<REALSXP,true,true>{
-	inline double operator()( double left, double right ) const {
-		return ( Rcpp::traits::is_na<REALSXP>( left ) || (left < right) ) ? left : right ;
-	}
-} ;
-template <> struct pmin_op<REALSXP,true,false> {
-	inline double operator()( double left, double right ) const {
-		return right < left ? right : left ;
-	}
-} ;
-template <> struct pmin_op<REALSXP,false,true> {
-	inline double operator()( double left, double right ) const {
-		return right < left ? right : left ;
-	}
-} ;
-template <> struct pmin_op<REALSXP,false,false> {
+// specialization for double: NA and NaN in either operand are kept
+template <bool LHS_NA, bool RHS_NA>
+struct pmin_op<REALSXP,LHS_NA,RHS_NA> {
 	inline double operator()( double left, double right ) const {
-		return left < right ? left : right ;
+		return kernels::min_value( left, right ) ;
 	}
 } ;
 
-// specializations for INTSXP. Since NA is represented as the smallest
-// int, NA is always the smallest, so it is safe to return NA
+// specialization for INTSXP: NA in either operand is kept
 template <bool LHS_NA, bool RHS_NA>
 struct pmin_op<INTSXP,LHS_NA,RHS_NA> {
     inline int operator()(int left, int right) const {
-        return left < right ? left : right ;
+        return kernels::min_value( left, right ) ;
     }
 } ;
 
 
-// general case
 template <int RTYPE, bool NA> class pmin_op_Vector_Primitive {
 public:
 	typedef typename Rcpp::traits::storage_type<RTYPE>::type STORAGE ;
@@ -69,24 +51,12 @@ public:
 	pmin_op_Vector_Primitive( STORAGE right_ ) :  right(right_) {}
 
 	inline STORAGE operator()( STORAGE left ) const {
-		return left < right ? left : right ;
+		return kernels::min_value( left, right ) ;
 	}
 
 private:
 	STORAGE right ;
 } ;
-// only special case we need to take care of
-template <> class pmin_op_Vector_Primitive<REALSXP,true> {
-public:
-	pmin_op_Vector_Primitive( double right_ ) :  right(right_) {}
-
-	inline double operator()( double left ) const {
-		return ( Rcpp::traits::is_na<REALSXP>( left ) || (left < right) ) ? left : right ;
-	}
-
-private:
-	double right ;
-} ;
 
 
 
@@ -104,6 +74,7 @@ class Pmin_Vector_Vector : public VectorBase<
 public:
 	typedef typename Rcpp::traits::storage_type<RTYPE>::type STORAGE ;
 	typedef pmin_op<RTYPE,LHS_NA,RHS_NA> OPERATOR ;
+	typedef typename kernels::all_direct<LHS_T,RHS_T>::type r_fill_kernel ;
 
 	Pmin_Vector_Vector( const LHS_T& lhs_, const RHS_T& rhs_ ) : lhs(lhs_), rhs(rhs_), op() {}
 
@@ -112,6 +83,16 @@ public:
 	}
         inline R_xlen_t size() const { return lhs.size() ; }
 
+	// writes all the elements at once, out may be lhs or rhs
+	inline void fill( STORAGE* out ) const {
+		kernels::Operand<STORAGE,LHS_T> x( lhs ) ;
+		kernels::Operand<STORAGE,RHS_T> y( rhs ) ;
+		kernels::apply( x, y, size(), out, kernels::MinKernel() ) ;
+	}
+
+	template <typename Iterator>
+	inline void fill( Iterator out ) const { kernels::fill_elements( *this, out ) ; }
+
 private:
 	const LHS_T& lhs ;
 	const RHS_T& rhs ;
@@ -132,14 +113,26 @@ class Pmin_Vector_Primitive : public VectorBase<
 public:
 	typedef typename Rcpp::traits::storage_type<RTYPE>::type STORAGE ;
 	typedef pmin_op_Vector_Primitive<RTYPE,LHS_NA> OPERATOR ;
+	typedef typename kernels::all_direct<LHS_T>::type r_fill_kernel ;
 
-	Pmin_Vector_Primitive( const LHS_T& lhs_, STORAGE rhs_ ) : lhs(lhs_), op(rhs_) {}
+	Pmin_Vector_Primitive( const LHS_T& lhs_, STORAGE rhs_ ) : lhs(lhs_), rhs(rhs_), op(rhs_) {}
 
         inline STORAGE operator[]( R_xlen_t i ) const { return op( lhs[i] ) ; }
         inline R_xlen_t size() const { return lhs.size() ; }
 
+	// writes all the elements at once, out may be lhs
+	inline void fill( STORAGE* out ) const {
+		kernels::Operand<STORAGE,LHS_T> x( lhs ) ;
+		kernels::Operand< STORAGE,kernels::Constant<STORAGE> > y( rhs ) ;
+		kernels::apply( x, y, size(), out, kernels::MinKernel() ) ;
+	}
+
+	template <typename Iterator>
+	inline void fill( Iterator out ) const { kernels::fill_elements( *this, out ) ; }
+
 private:
 	const LHS_T& lhs ;
+	STORAGE rhs ;
 	OPERATOR op ;
 } ;
 
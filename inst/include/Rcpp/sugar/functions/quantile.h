@@ -0,0 +1,353 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// quantile.h: Rcpp R/C++ interface class library -- sample quantiles
+//
+// Copyright (C) 2026  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp__sugar__quantile_h
+#define Rcpp__sugar__quantile_h
+
+namespace Rcpp{
+namespace sugar{
+namespace quantile_detail{
+
+    // Puts the elements of 0 based ranks ranks[first..last) of x at their
+    // sorted position, ranks sorted and all within [lo, hi). Selecting the
+    // middle rank splits the range for the others, so m ranks cost
+    // O(n log m) instead of m selections over the whole data.
+    inline void multi_select( double* x, R_xlen_t lo, R_xlen_t hi, const R_xlen_t* ranks, R_xlen_t first, R_xlen_t last ){
+        while( first < last ){
+            R_xlen_t mid = first + ( last - first ) / 2 ;
+            R_xlen_t k = ranks[mid] ;
+            std::nth_element( x + lo, x + k, x + hi ) ;
+            multi_select( x, lo, k, ranks, first, mid ) ;
+            lo = k + 1 ;
+            first = mid + 1 ;
+        }
+    }
+
+    // names as stats::quantile gives them: 100 * p with 7 significant
+    // digits in fixed notation, without trailing zeros, then "%"
+    inline std::string percent_name( double p ){
+        double v = 100.0 * p ;
+        char buffer[64] ;
+        if( v == 0.0 ){
+            return "0%" ;
+        }
+        int decimals = std::max( 0, 6 - static_cast<int>( std::floor( std::log10( std::fabs(v) ) ) ) ) ;
+        snprintf( buffer, sizeof(buffer), "%.*f", std::min( decimals, 40 ), v ) ;
+        std::string res( buffer ) ;
+        if( res.find('.') != std::string::npos ){
+            res.erase( res.find_last_not_of('0') + 1 ) ;
+            if( res[ res.size() - 1 ] == '.' ) res.erase( res.size() - 1 ) ;
+        }
+        return res + "%" ;
+    }
+
+    // the 1 based order statistics (j, j + 1) a quantile needs and the
+    // weight h of the second, following the code of stats::quantile
+    struct Position {
+        R_xlen_t lo, hi ;
+        double h ;
+        bool interpolate ;
+    } ;
+
+    inline Position position( double p, R_xlen_t n, int type ){
+        Position pos ;
+        const double fuzz = 4 * std::numeric_limits<double>::epsilon() ;
+        double dn = static_cast<double>(n) ;
+        if( type == 7 ){
+            double index = 1 + ( dn - 1 ) * p ;
+            double lo = std::floor( index ) ;
+            pos.lo = static_cast<R_xlen_t>( lo ) ;
+            pos.hi = static_cast<R_xlen_t>( std::ceil( index ) ) ;
+            pos.h = index - lo ;
+            pos.interpolate = index > lo ;
+            return pos ;
+        }
+        double nppm, j, h ;
+        if( type <= 3 ){
+            nppm = type == 3 ? dn * p - 0.5 : dn * p ;
+            j = std::floor( nppm + fuzz ) ;
+            switch( type ){
+            case 1: h = nppm > j ; break ;
+            case 2: h = ( ( nppm > j ) + 1 ) / 2.0 ; break ;
+            default: h = ( nppm != j ) || ( std::fmod( std::fabs(j), 2.0 ) == 1.0 ) ; break ;
+            }
+        } else {
+            double a, b ;
+            switch( type ){
+            case 4: a = 0 ; b = 1 ; break ;
+            case 5: a = b = 0.5 ; break ;
+            case 6: a = b = 0 ; break ;
+            case 8: a = b = 1.0 / 3 ; break ;
+            default: a = b = 3.0 / 8 ; break ;
+            }
+            nppm = a + p * ( dn + 1 - a - b ) ;
+            j = std::floor( nppm + fuzz ) ;
+            h = nppm - j ;
+            if( std::fabs(h) < fuzz ) h = 0 ;
+        }
+        // the data is padded with its minimum and maximum on both sides
+        pos.lo = static_cast<R_xlen_t>( std::min( std::max( j, 1.0 ), dn ) ) ;
+        pos.hi = static_cast<R_xlen_t>( std::min( std::max( j + 1, 1.0 ), dn ) ) ;
+        pos.h = h ;
+        pos.interpolate = h > 0 ;
+        return pos ;
+    }
+
+} // quantile_detail
+
+    // Approximate quantiles of data seen in one pass, in bounded memory:
+    // a merging t-digest. Values are buffered, then merged into centroids
+    // whose size is limited by the arcsine scale function, so that the
+    // tails are kept with more detail than the middle. compression is
+    // the number of centroids in the middle of the distribution, about
+    // twice that is kept at most; errors are typically well below 1/compression
+    // in rank, much smaller near 0 and 1. Digests of parts of the data can
+    // be merged, e.g. one per thread.
+    class QuantileSketch {
+    public:
+        QuantileSketch( double compression_ = 200 ) :
+            compression( compression_ ), means(), weights(), buffer(), total(0),
+            lowest( R_PosInf ), highest( R_NegInf )
+        {
+            if( ! ( compression >= 10 ) ) stop( "compression must be at least 10" ) ;
+            buffer.reserve( buffer_size() ) ;
+        }
+
+        // adds a value, NA and NaN are skipped
+        inline void push( double x ){
+            if( ISNAN(x) ) return ;
+            buffer.push_back( std::make_pair( x, 1.0 ) ) ;
+            if( static_cast<double>( buffer.size() ) >= buffer_size() ) compress() ;
+        }
+
+        template <int RTYPE, bool NA, typename T>
+        void push( const VectorBase<RTYPE,NA,T>& x ){
+            const T& ref = x.get_ref() ;
+            R_xlen_t n = ref.size() ;
+            for( R_xlen_t i=0; i<n; i++ ){
+                double value = internal::r_coerce<RTYPE,REALSXP>( ref[i] ) ;
+                push( value ) ;
+            }
+        }
+
+        // adds the values of other; merging a sketch with itself counts
+        // its values twice
+        void merge( const QuantileSketch& other ){
+            if( &other == this ){
+                QuantileSketch copy( other ) ;
+                merge( copy ) ;
+                return ;
+            }
+            for( size_t i=0; i<other.means.size(); i++ ){
+                buffer.push_back( std::make_pair( other.means[i], other.weights[i] ) ) ;
+            }
+            buffer.insert( buffer.end(), other.buffer.begin(), other.buffer.end() ) ;
+            // the centroids of other only give the means of its extremes
+            lowest = std::min( lowest, other.lowest ) ;
+            highest = std::max( highest, other.highest ) ;
+            compress() ;
+        }
+
+        // number of values pushed
+        double size() const {
+            double n = total ;
+            for( size_t i=0; i<buffer.size(); i++ ) n += buffer[i].second ;
+            return n ;
+        }
+
+        double quantile( double p ){
+            compress() ;
+            if( total == 0 || ISNAN(p) ) return NA_REAL ;
+            p = std::min( 1.0, std::max( 0.0, p ) ) ;
+            size_t m = means.size() ;
+            if( m == 1 ) return means[0] ;
+            double index = p * total ;
+            // below the center of the first centroid, between the minimum and it
+            if( index < weights[0] / 2 ){
+                return lowest + ( means[0] - lowest ) * index / ( weights[0] / 2 ) ;
+            }
+            double cumulated = weights[0] / 2 ;
+            for( size_t i=0; i+1<m; i++ ){
+                double step = ( weights[i] + weights[i+1] ) / 2 ;
+                if( cumulated + step > index ){
+                    double t = ( index - cumulated ) / step ;
+                    return means[i] + t * ( means[i+1] - means[i] ) ;
+                }
+                cumulated += step ;
+            }
+            double last = weights[m-1] / 2 ;
+            double t = std::min( 1.0, ( index - cumulated ) / last ) ;
+            return means[m-1] + t * ( highest - means[m-1] ) ;
+        }
+
+        NumericVector quantile( const NumericVector& probs ){
+            R_xlen_t np = probs.size() ;
+            NumericVector out = no_init( np ) ;
+            for( R_xlen_t i=0; i<np; i++ ) out[i] = quantile( probs[i] ) ;
+            return out ;
+        }
+
+        // number of centroids once the buffer is merged
+        R_xlen_t centroids(){
+            compress() ;
+            return static_cast<R_xlen_t>( means.size() ) ;
+        }
+
+    private:
+
+        inline double buffer_size() const { return 5 * compression ; }
+
+        inline double scale( double q ) const {
+            return compression / ( 2 * M_PI ) * std::asin( 2 * q - 1 ) ;
+        }
+
+        inline double inverse_scale( double k ) const {
+            double angle = std::min( k * 2 * M_PI / compression, M_PI / 2 ) ;
+            return ( std::sin( angle ) + 1 ) / 2 ;
+        }
+
+        void compress(){
+            if( buffer.empty() ) return ;
+            for( size_t i=0; i<means.size(); i++ ){
+                buffer.push_back( std::make_pair( means[i], weights[i] ) ) ;
+            }
+            std::sort( buffer.begin(), buffer.end() ) ;
+            lowest = std::min( lowest, buffer.front().first ) ;
+            highest = std::max( highest, buffer.back().first ) ;
+            double n = 0 ;
+            for( size_t i=0; i<buffer.size(); i++ ) n += buffer[i].second ;
+
+            means.clear() ;
+            weights.clear() ;
+            double mean = buffer[0].first, weight = buffer[0].second, before = 0 ;
+            double limit = n * inverse_scale( scale(0) + 1 ) ;
+            for( size_t i=1; i<buffer.size(); i++ ){
+                double proposed = weight + buffer[i].second ;
+                if( before + proposed <= limit ){
+                    mean += ( buffer[i].first - mean ) * buffer[i].second / proposed ;
+                    weight = proposed ;
+                } else {
+                    means.push_back( mean ) ;
+                    weights.push_back( weight ) ;
+                    before += weight ;
+                    limit = n * inverse_scale( scale( before / n ) + 1 ) ;
+                    mean = buffer[i].first ;
+                    weight = buffer[i].second ;
+                }
+            }
+            means.push_back( mean ) ;
+            weights.push_back( weight ) ;
+            total = n ;
+            buffer.clear() ;
+        }
+
+        double compression ;
+        std::vector<double> means ;
+        std::vector<double> weights ;
+        std::vector< std::pair<double,double> > buffer ;
+        double total ;
+        double lowest, highest ;
+    } ;
+
+} // sugar
+
+/**
+ * Sample quantiles of x at probs, like stats::quantile( x, probs,
+ * type = type, na.rm = na_rm ) for the 9 types of R, names included.
+ * The result is always a double vector.
+ *
+ * x is copied once. The order statistics the quantiles need are then
+ * selected in place together, each selection only partitioning the part
+ * of the data between its neighbours. Without na_rm, missing values are
+ * an error as in R.
+ *
+ * For data too large to copy, sugar::QuantileSketch gives approximate
+ * quantiles in one pass and bounded memory.
+ */
+template <int RTYPE, bool NA, typename T>
+inline NumericVector quantile( const VectorBase<RTYPE,NA,T>& x, const NumericVector& probs,
+                               int type = 7, bool na_rm = false ){
+    if( type < 1 || type > 9 ) stop( "'type' must be 1 to 9" ) ;
+    const T& ref = x.get_ref() ;
+    R_xlen_t size = ref.size() ;
+    std::vector<double> data ;
+    data.reserve( size ) ;
+    for( R_xlen_t i=0; i<size; i++ ){
+        double value = internal::r_coerce<RTYPE,REALSXP>( ref[i] ) ;
+        if( ISNAN(value) ){
+            if( na_rm ) continue ;
+            stop( "missing values and NaN's not allowed if 'na.rm' is FALSE" ) ;
+        }
+        data.push_back( value ) ;
+    }
+    R_xlen_t n = static_cast<R_xlen_t>( data.size() ) ;
+
+    const double eps = 100 * std::numeric_limits<double>::epsilon() ;
+    R_xlen_t np = probs.size() ;
+    std::vector<sugar::quantile_detail::Position> positions( np ) ;
+    std::vector<R_xlen_t> ranks ;
+    for( R_xlen_t i=0; i<np; i++ ){
+        double p = probs[i] ;
+        if( ISNAN(p) ) continue ;
+        if( p < -eps || p > 1 + eps ) stop( "'probs' outside [0,1]" ) ;
+        if( n == 0 ) continue ;
+        p = std::min( 1.0, std::max( 0.0, p ) ) ;
+        positions[i] = sugar::quantile_detail::position( p, n, type ) ;
+        ranks.push_back( positions[i].lo - 1 ) ;
+        ranks.push_back( positions[i].hi - 1 ) ;
+    }
+    std::sort( ranks.begin(), ranks.end() ) ;
+    ranks.erase( std::unique( ranks.begin(), ranks.end() ), ranks.end() ) ;
+    if( ! ranks.empty() ){
+        sugar::quantile_detail::multi_select( &data[0], 0, n, &ranks[0], 0, static_cast<R_xlen_t>( ranks.size() ) ) ;
+    }
+
+    NumericVector out = no_init( np ) ;
+    CharacterVector names( np ) ;
+    for( R_xlen_t i=0; i<np; i++ ){
+        double p = probs[i] ;
+        if( ISNAN(p) ){
+            out[i] = NA_REAL ;
+            names[i] = "" ;
+            continue ;
+        }
+        names[i] = sugar::quantile_detail::percent_name( p ) ;
+        if( n == 0 ){
+            out[i] = NA_REAL ;
+            continue ;
+        }
+        const sugar::quantile_detail::Position& pos = positions[i] ;
+        double lo = data[ pos.lo - 1 ], hi = data[ pos.hi - 1 ] ;
+        if( pos.h == 1 ){
+            out[i] = hi ;
+        } else if( pos.interpolate && lo != hi ){
+            out[i] = ( 1 - pos.h ) * lo + pos.h * hi ;
+        } else {
+            out[i] = lo ;
+        }
+    }
+    out.attr( "names" ) = names ;
+    return out ;
+}
+
+} // Rcpp
+
+#endif
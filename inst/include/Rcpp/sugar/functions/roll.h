@@ -0,0 +1,341 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// roll.h: Rcpp R/C++ interface class library -- rolling window statistics
+//
+// Copyright (C) 2026  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp__sugar__roll_h
+#define Rcpp__sugar__roll_h
+
+#include <cstring>
+#include <deque>
+
+// minimum number of windows per thread before a rolling statistic is
+// split; each thread reads up to width extra elements to fill its first
+// window
+#ifndef RCPP_ROLL_GRAIN
+#define RCPP_ROLL_GRAIN 65536
+#endif
+
+namespace Rcpp{
+namespace sugar{
+
+    // result i is computed over x[i - offset, i - offset + width)
+    struct RollWindow {
+        R_xlen_t width ;
+        R_xlen_t offset ;
+        bool partial ;
+        bool na_rm ;
+        int nthreads ;
+    } ;
+
+    inline RollWindow roll_window( R_xlen_t width, const char* align, bool partial, bool na_rm, int nthreads ){
+        if( width < 1 ) stop( "Invalid window width %d", static_cast<int>(width) ) ;
+        RollWindow win ;
+        win.width = width ;
+        if( ! std::strcmp( align, "right" ) ){
+            win.offset = width - 1 ;
+        } else if( ! std::strcmp( align, "center" ) ){
+            win.offset = ( width - 1 ) / 2 ;
+        } else if( ! std::strcmp( align, "left" ) ){
+            win.offset = 0 ;
+        } else {
+            stop( "Invalid `align` argument '%s'!", align ) ;
+        }
+        win.partial = partial ;
+        win.na_rm = na_rm ;
+        win.nthreads = nthreads ;
+        return win ;
+    }
+
+    // A running sum with Neumaier's compensation, so that adding and
+    // removing values does not accumulate rounding errors along the
+    // series. Infinite values are counted rather than added, otherwise
+    // removing one would turn the sum into NaN.
+    class RollSumState {
+    public:
+        RollSumState() : sum(0.0), comp(0.0), n(0), pos_inf(0), neg_inf(0) {}
+
+        inline void add( double v ){
+            n++ ;
+            if( v == R_PosInf ){ pos_inf++ ; return ; }
+            if( v == R_NegInf ){ neg_inf++ ; return ; }
+            accumulate( v ) ;
+        }
+        inline void remove( double v ){
+            n-- ;
+            if( v == R_PosInf ){ pos_inf-- ; return ; }
+            if( v == R_NegInf ){ neg_inf-- ; return ; }
+            accumulate( -v ) ;
+        }
+
+        inline R_xlen_t count() const { return n ; }
+        inline bool finite() const { return pos_inf == 0 && neg_inf == 0 ; }
+
+        inline double value() const {
+            if( pos_inf > 0 ) return neg_inf > 0 ? R_NaN : R_PosInf ;
+            if( neg_inf > 0 ) return R_NegInf ;
+            return sum + comp ;
+        }
+
+    private:
+        inline void accumulate( double v ){
+            double t = sum + v ;
+            if( std::fabs(sum) >= std::fabs(v) ){
+                comp += ( sum - t ) + v ;
+            } else {
+                comp += ( v - t ) + sum ;
+            }
+            sum = t ;
+        }
+
+        double sum, comp ;
+        R_xlen_t n, pos_inf, neg_inf ;
+    } ;
+
+    template <int RTYPE>
+    class RollSum {
+    public:
+        typedef typename traits::storage_type<RTYPE>::type STORAGE ;
+        const static int RESULT_RTYPE = REALSXP ;
+        typedef double result_type ;
+
+        RollSum( const STORAGE* x_ ) : x(x_), state() {}
+
+        inline void add( R_xlen_t j ){ state.add( static_cast<double>( x[j] ) ) ; }
+        inline void remove( R_xlen_t j ){ state.remove( static_cast<double>( x[j] ) ) ; }
+        inline double value() const { return state.value() ; }
+
+    private:
+        const STORAGE* x ;
+        RollSumState state ;
+    } ;
+
+    template <int RTYPE>
+    class RollMean {
+    public:
+        typedef typename traits::storage_type<RTYPE>::type STORAGE ;
+        const static int RESULT_RTYPE = REALSXP ;
+        typedef double result_type ;
+
+        RollMean( const STORAGE* x_ ) : x(x_), state() {}
+
+        inline void add( R_xlen_t j ){ state.add( static_cast<double>( x[j] ) ) ; }
+        inline void remove( R_xlen_t j ){ state.remove( static_cast<double>( x[j] ) ) ; }
+        inline double value() const {
+            if( state.count() == 0 ) return NA_REAL ;
+            return state.value() / state.count() ;
+        }
+
+    private:
+        const STORAGE* x ;
+        RollSumState state ;
+    } ;
+
+    // Welford's updates, run backwards to drop the value leaving the window
+    template <int RTYPE>
+    class RollVar {
+    public:
+        typedef typename traits::storage_type<RTYPE>::type STORAGE ;
+        const static int RESULT_RTYPE = REALSXP ;
+        typedef double result_type ;
+
+        RollVar( const STORAGE* x_ ) : x(x_), n(0), not_finite(0), mean(0.0), m2(0.0) {}
+
+        inline void add( R_xlen_t j ){
+            double v = static_cast<double>( x[j] ) ;
+            if( ! R_FINITE(v) ){ not_finite++ ; return ; }
+            n++ ;
+            double d = v - mean ;
+            mean += d / n ;
+            m2 += d * ( v - mean ) ;
+        }
+        inline void remove( R_xlen_t j ){
+            double v = static_cast<double>( x[j] ) ;
+            if( ! R_FINITE(v) ){ not_finite-- ; return ; }
+            n-- ;
+            if( n == 0 ){
+                mean = m2 = 0.0 ;
+                return ;
+            }
+            double d = v - mean ;
+            mean -= d / n ;
+            m2 -= d * ( v - mean ) ;
+        }
+        inline double value() const {
+            if( n + not_finite < 2 ) return NA_REAL ;
+            if( not_finite > 0 ) return R_NaN ;
+            return m2 > 0.0 ? m2 / ( n - 1 ) : 0.0 ;
+        }
+
+    private:
+        const STORAGE* x ;
+        R_xlen_t n, not_finite ;
+        double mean, m2 ;
+    } ;
+
+    // the indices of the values that can still become the minimum (or
+    // maximum) of the window, their values increasing (decreasing) from
+    // the front, so that each element is pushed and popped once
+    template <int RTYPE, bool MAX>
+    class RollExtreme {
+    public:
+        typedef typename traits::storage_type<RTYPE>::type STORAGE ;
+        const static int RESULT_RTYPE = RTYPE ;
+        typedef STORAGE result_type ;
+
+        RollExtreme( const STORAGE* x_ ) : x(x_), candidates() {}
+
+        inline void add( R_xlen_t j ){
+            STORAGE v = x[j] ;
+            while( ! candidates.empty() && ! before( x[ candidates.back() ], v ) ) candidates.pop_back() ;
+            candidates.push_back( j ) ;
+        }
+        inline void remove( R_xlen_t j ){
+            if( ! candidates.empty() && candidates.front() == j ) candidates.pop_front() ;
+        }
+        inline STORAGE value() const {
+            return candidates.empty() ? traits::get_na<RTYPE>() : x[ candidates.front() ] ;
+        }
+
+    private:
+        inline static bool before( STORAGE a, STORAGE b ){ return MAX ? a > b : a < b ; }
+
+        const STORAGE* x ;
+        std::deque<R_xlen_t> candidates ;
+    } ;
+
+    // the results [begin, end) of the window statistic Accumulator. The
+    // window is moved one element at a time, so each element is added
+    // and removed once, after up to width elements to fill the first one.
+    template <typename Accumulator, int RTYPE>
+    void roll_range( const typename traits::storage_type<RTYPE>::type* x, R_xlen_t n, const RollWindow& win,
+                     typename Accumulator::result_type* out, R_xlen_t begin, R_xlen_t end ){
+        typedef typename Accumulator::result_type OUT ;
+        const OUT na = traits::get_na<Accumulator::RESULT_RTYPE>() ;
+        Accumulator acc( x ) ;
+        R_xlen_t nas = 0 ;
+        R_xlen_t next_add = std::max<R_xlen_t>( begin - win.offset, 0 ) ;
+        R_xlen_t next_remove = next_add ;
+        for( R_xlen_t i=begin; i<end; i++ ){
+            R_xlen_t lo = i - win.offset ;
+            R_xlen_t hi = lo + win.width - 1 ;
+            R_xlen_t first = std::max<R_xlen_t>( lo, 0 ) ;
+            R_xlen_t last = std::min<R_xlen_t>( hi, n - 1 ) ;
+            for( ; next_remove < first; next_remove++ ){
+                if( traits::is_na<RTYPE>( x[next_remove] ) ) nas-- ; else acc.remove( next_remove ) ;
+            }
+            for( ; next_add <= last; next_add++ ){
+                if( traits::is_na<RTYPE>( x[next_add] ) ) nas++ ; else acc.add( next_add ) ;
+            }
+            bool complete = lo >= 0 && hi < n ;
+            if( ( ! complete && ! win.partial ) || ( nas > 0 && ! win.na_rm ) ){
+                out[i] = na ;
+            } else {
+                out[i] = acc.value() ;
+            }
+        }
+    }
+
+    template <int RTYPE, bool NA, typename T, typename Accumulator>
+    class Roll : public Lazy< Rcpp::Vector<Accumulator::RESULT_RTYPE>, Roll<RTYPE,NA,T,Accumulator> > {
+    public:
+        typedef typename Rcpp::VectorBase<RTYPE,NA,T> VEC_TYPE ;
+        typedef typename Rcpp::traits::storage_type<RTYPE>::type STORAGE ;
+        typedef typename Accumulator::result_type OUT ;
+        typedef Rcpp::Vector<Accumulator::RESULT_RTYPE> VECTOR ;
+
+        Roll( const VEC_TYPE& object_, const RollWindow& win_ ) : object(object_), win(win_){}
+
+        VECTOR get() const {
+            std::vector<STORAGE> buffer ;
+            const STORAGE* x = map_input( object, buffer ) ;
+            R_xlen_t n = object.size() ;
+            VECTOR result( no_init(n) ) ;
+            OUT* out = result.begin() ;
+            const RollWindow& w = win ;
+            internal::parallel_for( n, win.nthreads, [x, n, &w, out]( R_xlen_t begin, R_xlen_t end ){
+                roll_range<Accumulator,RTYPE>( x, n, w, out, begin, end ) ;
+            }, RCPP_ROLL_GRAIN ) ;
+            return result ;
+        }
+
+    private:
+        const VEC_TYPE& object ;
+        RollWindow win ;
+    } ;
+
+} // sugar
+
+/**
+ * Statistics over a window of width elements sliding along x, each
+ * computed in a single pass however wide the window:
+ *
+ * // [[Rcpp::export]]
+ * NumericVector moving_average( NumericVector x, int width ){
+ *     return roll_mean( x, width, "center" ) ;
+ * }
+ *
+ * align is "right" (result i covers the width elements up to x[i],
+ * the default), "left" (those from x[i]) or "center". Windows that run
+ * over an end of x are NA, unless partial is true, in which case they
+ * are computed over the elements they do cover. A window holding NA or
+ * NaN is NA, unless na_rm is true, in which case those are skipped.
+ *
+ * roll_sum, roll_mean and roll_var return doubles, roll_min and
+ * roll_max return the type of x. With nthreads greater than 1, long
+ * vectors are split into blocks computed on as many threads.
+ */
+template <int RTYPE, bool NA, typename T>
+inline sugar::Roll<RTYPE,NA,T,sugar::RollSum<RTYPE> >
+roll_sum( const VectorBase<RTYPE,NA,T>& x, R_xlen_t width, const char* align = "right",
+          bool partial = false, bool na_rm = false, int nthreads = 1 ){
+    return sugar::Roll<RTYPE,NA,T,sugar::RollSum<RTYPE> >( x, sugar::roll_window( width, align, partial, na_rm, nthreads ) ) ;
+}
+
+template <int RTYPE, bool NA, typename T>
+inline sugar::Roll<RTYPE,NA,T,sugar::RollMean<RTYPE> >
+roll_mean( const VectorBase<RTYPE,NA,T>& x, R_xlen_t width, const char* align = "right",
+           bool partial = false, bool na_rm = false, int nthreads = 1 ){
+    return sugar::Roll<RTYPE,NA,T,sugar::RollMean<RTYPE> >( x, sugar::roll_window( width, align, partial, na_rm, nthreads ) ) ;
+}
+
+template <int RTYPE, bool NA, typename T>
+inline sugar::Roll<RTYPE,NA,T,sugar::RollVar<RTYPE> >
+roll_var( const VectorBase<RTYPE,NA,T>& x, R_xlen_t width, const char* align = "right",
+          bool partial = false, bool na_rm = false, int nthreads = 1 ){
+    return sugar::Roll<RTYPE,NA,T,sugar::RollVar<RTYPE> >( x, sugar::roll_window( width, align, partial, na_rm, nthreads ) ) ;
+}
+
+template <int RTYPE, bool NA, typename T>
+inline sugar::Roll<RTYPE,NA,T,sugar::RollExtreme<RTYPE,false> >
+roll_min( const VectorBase<RTYPE,NA,T>& x, R_xlen_t width, const char* align = "right",
+          bool partial = false, bool na_rm = false, int nthreads = 1 ){
+    return sugar::Roll<RTYPE,NA,T,sugar::RollExtreme<RTYPE,false> >( x, sugar::roll_window( width, align, partial, na_rm, nthreads ) ) ;
+}
+
+template <int RTYPE, bool NA, typename T>
+inline sugar::Roll<RTYPE,NA,T,sugar::RollExtreme<RTYPE,true> >
+roll_max( const VectorBase<RTYPE,NA,T>& x, R_xlen_t width, const char* align = "right",
+          bool partial = false, bool na_rm = false, int nthreads = 1 ){
+    return sugar::Roll<RTYPE,NA,T,sugar::RollExtreme<RTYPE,true> >( x, sugar::roll_window( width, align, partial, na_rm, nthreads ) ) ;
+}
+
+} // Rcpp
+
+#endif
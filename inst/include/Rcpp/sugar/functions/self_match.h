@@ -64,12 +64,32 @@ private:
     IntegerVector result ;
 };
 
+template <int RTYPE, int OUT_RTYPE>
+inline Vector<OUT_RTYPE> self_match_impl( const Vector<RTYPE>& vec, int nthreads ){
+    typedef typename traits::storage_type<RTYPE>::type STORAGE ;
+    typedef typename traits::storage_type<OUT_RTYPE>::type OUT ;
+    R_xlen_t n = vec.size() ;
+    Vector<OUT_RTYPE> result = no_init(n) ;
+    hash_detail::self_match_ids<STORAGE,OUT> fun( internal::r_vector_start<RTYPE>( vec ), n, nthreads, result.begin() ) ;
+    hash_detail::dispatch_index( n, fun ) ;
+    return result ;
+}
+
 } // sugar
 
+// 1 based index of each value among the distinct values of x, in order
+// of first appearance, i.e. match( x, unique(x) )
+template <int RTYPE, bool NA, typename T>
+inline IntegerVector self_match( const VectorBase<RTYPE,NA,T>& x, int nthreads = 1 ){
+    Vector<RTYPE> vec(x) ;
+    return sugar::self_match_impl<RTYPE,INTSXP>( vec, nthreads ) ;
+}
+
+// same, as doubles, for long vectors with more than 2^31 - 1 distinct values
 template <int RTYPE, bool NA, typename T>
-inline IntegerVector self_match( const VectorBase<RTYPE,NA,T>& x ){
+inline NumericVector self_match_long( const VectorBase<RTYPE,NA,T>& x, int nthreads = 1 ){
     Vector<RTYPE> vec(x) ;
-    return sugar::SelfHash<RTYPE>(vec).fill_and_self_match() ;
+    return sugar::self_match_impl<RTYPE,REALSXP>( vec, nthreads ) ;
 }
 
 
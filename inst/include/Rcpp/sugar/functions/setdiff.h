@@ -25,134 +25,259 @@
 
 namespace Rcpp{
 namespace sugar{
+namespace set_detail{
 
-    template <typename SET>
-    class RemoveFromSet {
+    // values of src seen so far, in a flat open addressing table of
+    // positions into src
+    template <typename STORAGE, typename INDEX>
+    class HashedSet {
     public:
-        RemoveFromSet( SET& set_) : set(set_){}
+        HashedSet( const STORAGE* src_, R_xlen_t n ) : src(src_), table(src_, n) {}
 
-        template <typename T>
-        void operator()(T value){
-            set.erase( value );
+        // true when src[i] was not in the set yet
+        inline bool insert( R_xlen_t i ){
+            STORAGE value = hash_detail::normalize( src[i] ) ;
+            return table.insert( i, value, hash_detail::hash( value ) ) == i ;
+        }
+
+        inline bool contains( STORAGE value ) const {
+            value = hash_detail::normalize( value ) ;
+            return table.find( value, hash_detail::hash( value ) ) >= 0 ;
         }
 
     private:
-        SET& set ;
+        const STORAGE* src ;
+        hash_detail::FlatIndexTable<STORAGE,INDEX> table ;
     } ;
 
-    template <int RTYPE, bool LHS_NA, typename LHS_T, bool RHS_NA, typename RHS_T>
-    class SetDiff {
+    // same for integers within [lo, hi], one bit per value plus one for NA
+    class BitmapSet {
     public:
-        typedef typename Rcpp::traits::storage_type<RTYPE>::type STORAGE ;
+        BitmapSet( const int* src_, int lo_, int hi_ ) :
+            src(src_), lo(lo_), words( ( static_cast<uint64_t>( static_cast<int64_t>(hi_) - lo_ ) >> 6 ) + 1, 0 ), na(false)
+        {}
+
+        inline bool insert( R_xlen_t i ){
+            int value = src[i] ;
+            if( value == NA_INTEGER ){
+                bool res = ! na ;
+                na = true ;
+                return res ;
+            }
+            uint64_t k = static_cast<uint64_t>( static_cast<int64_t>(value) - lo ) ;
+            uint64_t bit = static_cast<uint64_t>(1) << ( k & 63 ) ;
+            uint64_t& word = words[ k >> 6 ] ;
+            bool res = ! ( word & bit ) ;
+            word |= bit ;
+            return res ;
+        }
 
-        SetDiff( const LHS_T& lhs, const RHS_T& rhs) :
-            lhs_set( get_const_begin(lhs), get_const_end(lhs) ),
-            rhs_set( get_const_begin(rhs), get_const_end(rhs) )
-        {
+        inline bool contains( int value ) const {
+            if( value == NA_INTEGER ) return na ;
+            int64_t k = static_cast<int64_t>(value) - lo ;
+            if( k < 0 || static_cast<uint64_t>(k >> 6) >= words.size() ) return false ;
+            return ( words[ k >> 6 ] >> ( k & 63 ) ) & 1 ;
+        }
 
-            std::for_each( rhs_set.begin(), rhs_set.end(), RemoveFromSet<SET>(lhs_set) ) ;
+    private:
+        const int* src ;
+        int lo ;
+        std::vector<uint64_t> words ;
+        bool na ;
+    } ;
+
+    template <typename STORAGE, typename Op>
+    struct hashed_sets {
+        hashed_sets( Op& op_ ) : op(op_){}
+        template <typename INDEX> void run(){
+            HashedSet<STORAGE,INDEX> xs( op.x, op.nx ), ys( op.y, op.ny ) ;
+            op( xs, ys ) ;
         }
+        Op& op ;
+    } ;
 
-        Vector<RTYPE> get() const {
-            R_xlen_t n = lhs_set.size() ;
-            Vector<RTYPE> out = no_init(n) ;
-            std::copy( lhs_set.begin(), lhs_set.end(), out.begin() ) ;
-            return out ;
+    // calls op( xs, ys ) with empty sets able to hold op.x and op.y
+    template <typename STORAGE, typename Op>
+    inline void with_sets( const STORAGE*, Op& op ){
+        hashed_sets<STORAGE,Op> fun( op ) ;
+        hash_detail::dispatch_index( std::max( op.nx, op.ny ), fun ) ;
+    }
+
+    // integers (and logicals) spanning no more values than 64 times
+    // their number use bitmaps rather than hash tables
+    template <typename Op>
+    inline void with_sets( const int*, Op& op ){
+        int lo = INT_MAX, hi = INT_MIN ;
+        for( R_xlen_t i=0; i<op.nx; i++ ){
+            int v = op.x[i] ;
+            if( v == NA_INTEGER ) continue ;
+            if( v < lo ) lo = v ;
+            if( v > hi ) hi = v ;
+        }
+        for( R_xlen_t i=0; i<op.ny; i++ ){
+            int v = op.y[i] ;
+            if( v == NA_INTEGER ) continue ;
+            if( v < lo ) lo = v ;
+            if( v > hi ) hi = v ;
+        }
+        if( lo > hi ){
+            lo = hi = 0 ;
+        }
+        if( ( static_cast<double>(hi) - lo ) / 64 <= static_cast<double>( op.nx + op.ny ) ){
+            BitmapSet xs( op.x, lo, hi ), ys( op.y, lo, hi ) ;
+            op( xs, ys ) ;
+            return ;
         }
+        hashed_sets<int,Op> fun( op ) ;
+        hash_detail::dispatch_index( std::max( op.nx, op.ny ), fun ) ;
+    }
+
+    template <typename STORAGE>
+    struct SetOperands {
+        SetOperands( const STORAGE* x_, R_xlen_t nx_, const STORAGE* y_, R_xlen_t ny_ ) :
+            x(x_), nx(nx_), y(y_), ny(ny_), out(){}
+        const STORAGE* x ; R_xlen_t nx ; const STORAGE* y ; R_xlen_t ny ;
+        std::vector<STORAGE> out ;
+    } ;
 
-    private:
-        typedef std::unordered_set<STORAGE> SET ;
-        typedef typename SET::const_iterator ITERATOR ;
-        SET lhs_set ;
-        SET rhs_set ;
+    // unique( x[ ! x %in% y ] )
+    template <typename STORAGE>
+    struct setdiff_op : SetOperands<STORAGE> {
+        setdiff_op( const STORAGE* x_, R_xlen_t nx_, const STORAGE* y_, R_xlen_t ny_ ) :
+            SetOperands<STORAGE>( x_, nx_, y_, ny_ ){}
+        template <typename SET> void operator()( SET& xs, SET& ys ){
+            for( R_xlen_t j=0; j<this->ny; j++ ) ys.insert(j) ;
+            for( R_xlen_t i=0; i<this->nx; i++ ){
+                if( xs.insert(i) && ! ys.contains( this->x[i] ) ) this->out.push_back( this->x[i] ) ;
+            }
+        }
+    } ;
 
+    // unique( x[ x %in% y ] )
+    template <typename STORAGE>
+    struct intersect_op : SetOperands<STORAGE> {
+        intersect_op( const STORAGE* x_, R_xlen_t nx_, const STORAGE* y_, R_xlen_t ny_ ) :
+            SetOperands<STORAGE>( x_, nx_, y_, ny_ ){}
+        template <typename SET> void operator()( SET& xs, SET& ys ){
+            for( R_xlen_t j=0; j<this->ny; j++ ) ys.insert(j) ;
+            for( R_xlen_t i=0; i<this->nx; i++ ){
+                if( xs.insert(i) && ys.contains( this->x[i] ) ) this->out.push_back( this->x[i] ) ;
+            }
+        }
     } ;
 
-    template <int RTYPE, bool LHS_NA, typename LHS_T, bool RHS_NA, typename RHS_T>
-    class SetEqual {
+    // unique( c( x, y ) )
+    template <typename STORAGE>
+    struct union_op : SetOperands<STORAGE> {
+        union_op( const STORAGE* x_, R_xlen_t nx_, const STORAGE* y_, R_xlen_t ny_ ) :
+            SetOperands<STORAGE>( x_, nx_, y_, ny_ ){}
+        template <typename SET> void operator()( SET& xs, SET& ys ){
+            for( R_xlen_t i=0; i<this->nx; i++ ){
+                if( xs.insert(i) ) this->out.push_back( this->x[i] ) ;
+            }
+            for( R_xlen_t j=0; j<this->ny; j++ ){
+                if( ys.insert(j) && ! xs.contains( this->y[j] ) ) this->out.push_back( this->y[j] ) ;
+            }
+        }
+    } ;
+
+    // all( x %in% y ) && all( y %in% x )
+    template <typename STORAGE>
+    struct setequal_op : SetOperands<STORAGE> {
+        setequal_op( const STORAGE* x_, R_xlen_t nx_, const STORAGE* y_, R_xlen_t ny_ ) :
+            SetOperands<STORAGE>( x_, nx_, y_, ny_ ), equal(true){}
+        template <typename SET> void operator()( SET& xs, SET& ys ){
+            for( R_xlen_t i=0; i<this->nx; i++ ) xs.insert(i) ;
+            for( R_xlen_t j=0; j<this->ny; j++ ) ys.insert(j) ;
+            for( R_xlen_t i=0; equal && i<this->nx; i++ ) equal = ys.contains( this->x[i] ) ;
+            for( R_xlen_t j=0; equal && j<this->ny; j++ ) equal = xs.contains( this->y[j] ) ;
+        }
+        bool equal ;
+    } ;
+
+    template <int RTYPE, template <typename> class Op>
+    class SetOperation {
     public:
         typedef typename Rcpp::traits::storage_type<RTYPE>::type STORAGE ;
 
-        SetEqual( const LHS_T& lhs, const RHS_T& rhs) :
-            lhs_set( get_const_begin(lhs), get_const_end(lhs) ),
-            rhs_set( get_const_begin(rhs), get_const_end(rhs) )
+        // sugar expressions are materialized into lhs and rhs, which hold
+        // them (and protect the strings op.out refers to) as long as op
+        SetOperation( const Vector<RTYPE>& lhs_, const Vector<RTYPE>& rhs_ ) :
+            lhs( lhs_ ), rhs( rhs_ ),
+            op( internal::r_vector_start<RTYPE>(lhs), lhs.size(), internal::r_vector_start<RTYPE>(rhs), rhs.size() )
         {
+            with_sets( op.x, op ) ;
         }
 
-        bool get() const {
-            if( lhs_set.size() != rhs_set.size() ) return false ;
-
-            ITERATOR it = lhs_set.begin(), end = lhs_set.end(), rhs_end = rhs_set.end() ;
-            for( ; it != end; ){
-                if( rhs_set.find(*it++) == rhs_end ) return false ;
-            }
-            return true ;
+        Vector<RTYPE> values() const {
+            Vector<RTYPE> out = no_init( op.out.size() ) ;
+            std::copy( op.out.begin(), op.out.end(), out.begin() ) ;
+            return out ;
         }
 
     private:
-        typedef std::unordered_set<STORAGE> SET ;
-        typedef typename SET::const_iterator ITERATOR ;
-        SET lhs_set ;
-        SET rhs_set ;
+        Vector<RTYPE> lhs, rhs ;
 
+    public:
+        Op<STORAGE> op ;
     } ;
 
+} // set_detail
+
+    // The set operations follow R: results hold the distinct values in
+    // the order of their first appearance (in lhs, then rhs for union),
+    // NA and NaN are values like any other and 0 equals -0.
+
     template <int RTYPE, bool LHS_NA, typename LHS_T, bool RHS_NA, typename RHS_T>
-    class Intersect {
+    class SetDiff {
     public:
-        typedef typename Rcpp::traits::storage_type<RTYPE>::type STORAGE ;
+        SetDiff( const LHS_T& lhs, const RHS_T& rhs) : operation( lhs, rhs ) {}
 
-        Intersect( const LHS_T& lhs, const RHS_T& rhs) :
-            intersect()
-        {
+        Vector<RTYPE> get() const {
+            return operation.values() ;
+        }
 
-            SET lhs_set( get_const_begin(lhs), get_const_end(lhs) ) ;
-            SET rhs_set( get_const_begin(rhs), get_const_end(rhs) ) ;
+    private:
+        set_detail::SetOperation<RTYPE,set_detail::setdiff_op> operation ;
+    } ;
 
-            ITERATOR end = lhs_set.end() ;
-            ITERATOR rhs_end = rhs_set.end() ;
-            for( ITERATOR it=lhs_set.begin(); it != end; it++){
-                if( rhs_set.find(*it) != rhs_end ) intersect.insert(*it) ;
-            }
+    template <int RTYPE, bool LHS_NA, typename LHS_T, bool RHS_NA, typename RHS_T>
+    class SetEqual {
+    public:
+        SetEqual( const LHS_T& lhs, const RHS_T& rhs) : operation( lhs, rhs ) {}
+
+        bool get() const {
+            return operation.op.equal ;
         }
 
+    private:
+        set_detail::SetOperation<RTYPE,set_detail::setequal_op> operation ;
+    } ;
+
+    template <int RTYPE, bool LHS_NA, typename LHS_T, bool RHS_NA, typename RHS_T>
+    class Intersect {
+    public:
+        Intersect( const LHS_T& lhs, const RHS_T& rhs) : operation( lhs, rhs ) {}
+
         Vector<RTYPE> get() const {
-            R_xlen_t n = intersect.size() ;
-            Vector<RTYPE> out = no_init(n) ;
-            std::copy( intersect.begin(), intersect.end(), out.begin() ) ;
-            return out ;
+            return operation.values() ;
         }
 
     private:
-        typedef std::unordered_set<STORAGE> SET ;
-        typedef typename SET::const_iterator ITERATOR ;
-        SET intersect ;
-
+        set_detail::SetOperation<RTYPE,set_detail::intersect_op> operation ;
     } ;
 
     template <int RTYPE, bool LHS_NA, typename LHS_T, bool RHS_NA, typename RHS_T>
     class Union {
     public:
-        typedef typename Rcpp::traits::storage_type<RTYPE>::type STORAGE ;
-
-        Union( const LHS_T& lhs, const RHS_T& rhs) :
-            result( get_const_begin(lhs), get_const_end(lhs) )
-        {
-            result.insert( get_const_begin(rhs), get_const_end(rhs) ) ;
-        }
+        Union( const LHS_T& lhs, const RHS_T& rhs) : operation( lhs, rhs ) {}
 
         Vector<RTYPE> get() const {
-            R_xlen_t n = result.size() ;
-            Vector<RTYPE> out = no_init(n) ;
-            std::copy( result.begin(), result.end(), out.begin() ) ;
-            return out ;
+            return operation.values() ;
         }
 
     private:
-        typedef std::unordered_set<STORAGE> SET ;
-        typedef typename SET::const_iterator ITERATOR ;
-        SET result ;
-
+        set_detail::SetOperation<RTYPE,set_detail::union_op> operation ;
     } ;
 
 
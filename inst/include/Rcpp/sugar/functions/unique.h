@@ -59,14 +59,30 @@ public:
 } ;
 
 
+// 1 for the elements that are the first of their value, 0 for repeats
+template <int RTYPE>
+inline std::vector<unsigned char> first_flags( const Vector<RTYPE>& vec, int nthreads ){
+    typedef typename traits::storage_type<RTYPE>::type STORAGE ;
+    R_xlen_t n = vec.size() ;
+    std::vector<unsigned char> flags( n ) ;
+    hash_detail::first_flags<STORAGE> fun( internal::r_vector_start<RTYPE>( vec ), n, nthreads, n ? &flags[0] : static_cast<unsigned char*>(0) ) ;
+    hash_detail::dispatch_index( n, fun ) ;
+    return flags ;
+}
+
 } // sugar
 
+// values in the order of their first appearance, like unique() in R
 template <int RTYPE, bool NA, typename T>
-inline Vector<RTYPE> unique( const VectorBase<RTYPE,NA,T>& t ){
+inline Vector<RTYPE> unique( const VectorBase<RTYPE,NA,T>& t, int nthreads = 1 ){
 	Vector<RTYPE> vec(t) ;
-	sugar::IndexHash<RTYPE> hash(vec) ;
-	hash.fill() ;
-	return hash.keys() ;
+	std::vector<unsigned char> flags = sugar::first_flags<RTYPE>( vec, nthreads ) ;
+	R_xlen_t n = vec.size(), m = std::count( flags.begin(), flags.end(), 1 ) ;
+	Vector<RTYPE> res = no_init(m) ;
+	for( R_xlen_t i=0, j=0; i<n; i++ ){
+	    if( flags[i] ) res[j++] = vec[i] ;
+	}
+	return res ;
 }
 template <int RTYPE, bool NA, typename T>
 inline Vector<RTYPE> sort_unique( const VectorBase<RTYPE,NA,T>& t , bool decreasing = false){
@@ -3,7 +3,7 @@
 // outer.h: Rcpp R/C++ interface class library -- outer
 //
 // Copyright (C) 2010 - 2024 Dirk Eddelbuettel and Romain Francois
-// Copyright (C) 2025        Dirk Eddelbuettel, Romain Francois and Iñaki Ucar
+// Copyright (C) 2025 - 2026 Dirk Eddelbuettel, Romain Francois and Iñaki Ucar
 //
 // This file is part of Rcpp.
 //
@@ -23,6 +23,12 @@
 #ifndef Rcpp__sugar__outer_h
 #define Rcpp__sugar__outer_h
 
+// number of lhs elements kept hot in cache while a block of columns is
+// filled, 2048 doubles are 16kB
+#ifndef RCPP_OUTER_BLOCK
+#define RCPP_OUTER_BLOCK 2048
+#endif
+
 namespace Rcpp{
 namespace sugar{
 
@@ -45,14 +51,18 @@ public:
     typedef Rcpp::VectorBase<RTYPE,LHS_NA,LHS_T> LHS_TYPE ;
     typedef Rcpp::VectorBase<RTYPE,RHS_NA,RHS_T> RHS_TYPE ;
 
-    typedef Rcpp::internal::LazyVector<LHS_TYPE> LHS_LAZY ;
-    typedef Rcpp::internal::LazyVector<RHS_TYPE> RHS_LAZY ;
-
     typedef typename Rcpp::traits::r_vector_element_converter<RESULT_R_TYPE>::type converter_type ;
     typedef typename Rcpp::traits::storage_type<RESULT_R_TYPE>::type STORAGE ;
+    typedef typename Rcpp::traits::storage_type<RTYPE>::type INPUT_STORAGE ;
 
+    // both expressions are evaluated exactly once, so that the nr * nc
+    // function calls below only read contiguous memory
     Outer( const LHS_TYPE& lhs_, const RHS_TYPE& rhs_, Function fun_ ) :
-        lhs(lhs_), rhs(rhs_), fun(fun_), nr(lhs_.size()), nc(rhs_.size()) {}
+        lhs(), rhs(), fun(fun_), nr(lhs_.size()), nc(rhs_.size())
+    {
+        materialize( lhs_, lhs ) ;
+        materialize( rhs_, rhs ) ;
+    }
 
     inline STORAGE operator()( int i, int j ) const {
         return converter_type::get( fun( lhs[i], rhs[j] ) );
@@ -62,10 +72,105 @@ public:
     inline int nrow() const { return nr; }
     inline int ncol() const { return nc; }
 
+    /**
+     * writes the nrow() x ncol() result in column major order to out,
+     * splitting the columns over nthreads threads. The function must not
+     * use the R API when more than one thread is requested; results that
+     * are not plain numbers are always computed on the calling thread.
+     */
+    template <typename Iterator>
+    void fill( Iterator out, int nthreads = 1 ) const {
+        if( ! traits::is_thread_safe_rtype<RESULT_R_TYPE>::value ) nthreads = 1 ;
+        const Outer& self = *this ;
+        internal::parallel_for( nc, nthreads, [&self, out]( R_xlen_t j0, R_xlen_t j1 ){
+            self.fill_columns( out, j0, j1, false ) ;
+        }, 64 ) ;
+    }
+
+    /**
+     * same as fill() for a square result of a function that satisfies
+     * fun(x, y) == fun(y, x): only the lower triangle is computed and it
+     * is then mirrored onto the upper triangle.
+     */
+    template <typename Iterator>
+    void fill_symmetric( Iterator out, int nthreads = 1 ) const {
+        if( nr != nc ) throw std::range_error( "symmetric outer needs a square result" ) ;
+        if( ! traits::is_thread_safe_rtype<RESULT_R_TYPE>::value ) nthreads = 1 ;
+        int nt = internal::parallel_threads( nc, nthreads, 64 ) ;
+        const Outer& self = *this ;
+
+        // column j holds nc - j elements of the lower triangle and j of
+        // the upper one, so give each thread the same number of elements
+        std::vector<R_xlen_t> lower = triangle_bounds( nt, true ) ;
+        internal::parallel_ranges( lower, [&self, out]( R_xlen_t j0, R_xlen_t j1 ){
+            self.fill_columns( out, j0, j1, true ) ;
+        } ) ;
+        std::vector<R_xlen_t> upper = triangle_bounds( nt, false ) ;
+        internal::parallel_ranges( upper, [&self, out]( R_xlen_t j0, R_xlen_t j1 ){
+            self.mirror_columns( out, j0, j1 ) ;
+        } ) ;
+    }
+
 private:
 
-    LHS_LAZY lhs ;
-    RHS_LAZY rhs ;
+    template <typename EXPR>
+    static void materialize( const EXPR& expr, std::vector<INPUT_STORAGE>& data ){
+        R_xlen_t n = expr.size() ;
+        data.resize( n ) ;
+        for( R_xlen_t i=0; i<n; i++ ) data[i] = expr[i] ;
+    }
+
+    template <typename Iterator>
+    void fill_columns( Iterator out, R_xlen_t j0, R_xlen_t j1, bool lower_only ) const {
+        const R_xlen_t block = RCPP_OUTER_BLOCK ;
+        const INPUT_STORAGE* x = lhs.empty() ? 0 : &lhs[0] ;
+        for( R_xlen_t ib=0; ib<nr; ib += block ){
+            R_xlen_t imax = std::min<R_xlen_t>( ib + block, nr ) ;
+            for( R_xlen_t j=j0; j<j1; j++ ){
+                R_xlen_t i = lower_only ? std::max( ib, j ) : ib ;
+                const INPUT_STORAGE y = rhs[j] ;
+                Iterator col = out + j * nr ;
+                for( ; i<imax; i++ ){
+                    col[i] = converter_type::get( fun( x[i], y ) ) ;
+                }
+            }
+        }
+    }
+
+    // copies the strict upper part of columns [j0, j1) from the lower
+    // triangle, in tiles so that the strided reads stay in cache
+    template <typename Iterator>
+    void mirror_columns( Iterator out, R_xlen_t j0, R_xlen_t j1 ) const {
+        const R_xlen_t tile = RCPP_TILE_SIZE ;
+        for( R_xlen_t jj=j0; jj<j1; jj += tile ){
+            R_xlen_t jmax = std::min( jj + tile, j1 ) ;
+            for( R_xlen_t ii=0; ii<jmax; ii += tile ){
+                for( R_xlen_t j=jj; j<jmax; j++ ){
+                    R_xlen_t imax = std::min( ii + tile, j ) ;
+                    Iterator col = out + j * nr ;
+                    for( R_xlen_t i=ii; i<imax; i++ ){
+                        col[i] = out[ j + i * nr ] ;
+                    }
+                }
+            }
+        }
+    }
+
+    std::vector<R_xlen_t> triangle_bounds( int nt, bool lower ) const {
+        std::vector<R_xlen_t> bounds( nt + 1, nc ) ;
+        bounds[0] = 0 ;
+        double total = static_cast<double>( nc ) * ( nc + 1 ) / 2.0 ;
+        double done = 0.0 ;
+        int k = 1 ;
+        for( R_xlen_t j=0; j<nc && k<nt; j++ ){
+            done += lower ? ( nc - j ) : ( j + 1 ) ;
+            if( done >= total * k / nt ) bounds[k++] = j + 1 ;
+        }
+        return bounds ;
+    }
+
+    std::vector<INPUT_STORAGE> lhs ;
+    std::vector<INPUT_STORAGE> rhs ;
 
     Function fun ;
     int nr, nc ;
@@ -86,6 +191,38 @@ outer(
     return sugar::Outer<RTYPE,LHS_NA,LHS_T,RHS_NA,RHS_T,Function>( lhs, rhs, fun ) ;
 }
 
+// eager version: the result is filled in column blocks, split over nthreads
+template <int RTYPE,
+          bool LHS_NA, typename LHS_T,
+          bool RHS_NA, typename RHS_T,
+          typename Function >
+inline Matrix< sugar::Outer<RTYPE,LHS_NA,LHS_T,RHS_NA,RHS_T,Function>::RESULT_R_TYPE >
+outer(
+      const Rcpp::VectorBase<RTYPE,LHS_NA,LHS_T>& lhs,
+      const Rcpp::VectorBase<RTYPE,RHS_NA,RHS_T>& rhs,
+      Function fun, int nthreads ){
+
+    typedef sugar::Outer<RTYPE,LHS_NA,LHS_T,RHS_NA,RHS_T,Function> OUTER ;
+    OUTER expr( lhs, rhs, fun ) ;
+    Matrix<OUTER::RESULT_R_TYPE> res( no_init( expr.nrow(), expr.ncol() ) ) ;
+    expr.fill( res.begin(), nthreads ) ;
+    return res ;
+}
+
+// outer(x, x, fun) for a symmetric fun, computing the lower triangle only
+template <int RTYPE, bool NA, typename T, typename Function >
+inline Matrix< sugar::Outer<RTYPE,NA,T,NA,T,Function>::RESULT_R_TYPE >
+outer_symmetric(
+      const Rcpp::VectorBase<RTYPE,NA,T>& x,
+      Function fun, int nthreads = 1 ){
+
+    typedef sugar::Outer<RTYPE,NA,T,NA,T,Function> OUTER ;
+    OUTER expr( x, x, fun ) ;
+    Matrix<OUTER::RESULT_R_TYPE> res( no_init( expr.nrow(), expr.ncol() ) ) ;
+    expr.fill_symmetric( res.begin(), nthreads ) ;
+    return res ;
+}
+
 } // Rcpp
 
 #endif
@@ -25,6 +25,7 @@
 
 #include <Rcpp/sugar/tools/iterator.h>
 #include <Rcpp/sugar/tools/safe_math.h>
+#include <Rcpp/sugar/tools/kernels.h>
 #include <Rcpp/sugar/block/block.h>
 
 #include <Rcpp/hash/hash.h>
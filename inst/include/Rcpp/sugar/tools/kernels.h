@@ -0,0 +1,178 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// kernels.h: Rcpp R/C++ interface class library -- bulk evaluation of
+//            element wise sugar expressions
+//
+// Copyright (C) 2026  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp__sugar__tools_kernels_h
+#define Rcpp__sugar__tools_kernels_h
+
+namespace Rcpp{
+namespace sugar{
+namespace kernels{
+
+    // The element functions are written as selects without branches, so
+    // that the loops below compile to compares and blends. NaN (and so NA)
+    // fails every comparison, x != x is its mask. Integer NA is the
+    // smallest int and compares like a number, x == NA_INTEGER is its mask.
+
+    template <typename T>
+    inline T min_value( T x, T y ){ return x < y ? x : y ; }
+    inline double min_value( double x, double y ){ return ( x < y || x != x ) ? x : y ; }
+    inline int min_value( int x, int y ){
+        return ( ( x == NA_INTEGER ) | ( y == NA_INTEGER ) ) ? NA_INTEGER : ( x < y ? x : y ) ;
+    }
+
+    template <typename T>
+    inline T max_value( T x, T y ){ return x > y ? x : y ; }
+    inline double max_value( double x, double y ){ return ( x > y || x != x ) ? x : y ; }
+    inline int max_value( int x, int y ){
+        return ( ( x == NA_INTEGER ) | ( y == NA_INTEGER ) ) ? NA_INTEGER : ( x > y ? x : y ) ;
+    }
+
+    // NaN compares false both ways and is kept
+    template <typename T>
+    inline T clamp_value( T x, T lo, T hi ){ return x < lo ? lo : ( x > hi ? hi : x ) ; }
+    inline int clamp_value( int x, int lo, int hi ){
+        int value = x < lo ? lo : ( x > hi ? hi : x ) ;
+        return x == NA_INTEGER ? NA_INTEGER : value ;
+    }
+
+    template <typename T>
+    inline T select_value( int cond, T yes, T no, T na ){
+        T value = cond ? yes : no ;
+        return cond == NA_LOGICAL ? na : value ;
+    }
+
+    // a scalar operand, indexed like a vector
+    template <typename STORAGE>
+    struct Constant {
+        Constant( STORAGE value_ ) : value(value_){}
+        inline STORAGE operator[]( R_xlen_t ) const { return value ; }
+        STORAGE value ;
+    } ;
+
+    // Reads an operand in place: get( begin, n ) gives something indexed
+    // by 0..n-1 holding its elements begin..begin+n-1. Only vectors and
+    // scalars are operands of kernels, see all_direct.
+    template <typename STORAGE, typename T>
+    class Operand ;
+
+    template <typename STORAGE, int RTYPE, template <class> class StoragePolicy>
+    class Operand< STORAGE, Vector<RTYPE,StoragePolicy> > {
+    public:
+        typedef const STORAGE* type ;
+        Operand( const Vector<RTYPE,StoragePolicy>& x ) : start( internal::r_vector_start<RTYPE>(x) ) {}
+        inline type get( R_xlen_t begin, R_xlen_t ){ return start + begin ; }
+    private:
+        const STORAGE* start ;
+    } ;
+
+    template <typename STORAGE>
+    class Operand< STORAGE, Constant<STORAGE> > {
+    public:
+        typedef Constant<STORAGE> type ;
+        Operand( const Constant<STORAGE>& x_ ) : x(x_) {}
+        inline type get( R_xlen_t, R_xlen_t ){ return x ; }
+    private:
+        Constant<STORAGE> x ;
+    } ;
+
+    // Are all the operands vectors or scalars?
+    // Expressions declare their fill kernel only then. Other operands are
+    // evaluated element by element as before: evaluating them into a
+    // buffer for the kernel measured no faster, and slower for ifelse(),
+    // which then computes both branches.
+    template <typename T>
+    struct is_direct : public Rcpp::traits::false_type {} ;
+
+    template <int RTYPE, template <class> class StoragePolicy>
+    struct is_direct< Vector<RTYPE,StoragePolicy> > : public Rcpp::traits::true_type {} ;
+
+    template <typename STORAGE>
+    struct is_direct< Constant<STORAGE> > : public Rcpp::traits::true_type {} ;
+
+    template <typename A, typename B = Constant<int>, typename C = Constant<int> >
+    struct all_direct : public Rcpp::traits::integral_constant<bool,
+        is_direct<A>::value && is_direct<B>::value && is_direct<C>::value> {} ;
+
+    struct MinKernel {
+        template <typename STORAGE, typename X, typename Y>
+        inline void operator()( X x, Y y, R_xlen_t n, STORAGE* out ) const {
+            for( R_xlen_t i=0; i<n; i++ ) out[i] = min_value( x[i], y[i] ) ;
+        }
+    } ;
+
+    struct MaxKernel {
+        template <typename STORAGE, typename X, typename Y>
+        inline void operator()( X x, Y y, R_xlen_t n, STORAGE* out ) const {
+            for( R_xlen_t i=0; i<n; i++ ) out[i] = max_value( x[i], y[i] ) ;
+        }
+    } ;
+
+    template <typename STORAGE>
+    struct ClampKernel {
+        ClampKernel( STORAGE lo_, STORAGE hi_ ) : lo(lo_), hi(hi_){}
+        template <typename X>
+        inline void operator()( X x, R_xlen_t n, STORAGE* out ) const {
+            for( R_xlen_t i=0; i<n; i++ ) out[i] = clamp_value( static_cast<STORAGE>( x[i] ), lo, hi ) ;
+        }
+        STORAGE lo, hi ;
+    } ;
+
+    template <typename STORAGE>
+    struct SelectKernel {
+        SelectKernel( STORAGE na_ ) : na(na_){}
+        template <typename C, typename Y, typename N>
+        inline void operator()( C cond, Y yes, N no, R_xlen_t n, STORAGE* out ) const {
+            for( R_xlen_t i=0; i<n; i++ ) out[i] = select_value<STORAGE>( cond[i], yes[i], no[i], na ) ;
+        }
+        STORAGE na ;
+    } ;
+
+    // out[0..n) = kernel over the operands. Element i of the operands
+    // is read before out[i] is written, so out may be one of the operands.
+    template <typename STORAGE, typename A, typename Kernel>
+    inline void apply( A& a, R_xlen_t n, STORAGE* out, const Kernel& kernel ){
+        kernel( a.get( 0, n ), n, out ) ;
+    }
+
+    template <typename STORAGE, typename A, typename B, typename Kernel>
+    inline void apply( A& a, B& b, R_xlen_t n, STORAGE* out, const Kernel& kernel ){
+        kernel( a.get( 0, n ), b.get( 0, n ), n, out ) ;
+    }
+
+    template <typename STORAGE, typename A, typename B, typename C, typename Kernel>
+    inline void apply( A& a, B& b, C& c, R_xlen_t n, STORAGE* out, const Kernel& kernel ){
+        kernel( a.get( 0, n ), b.get( 0, n ), c.get( 0, n ), n, out ) ;
+    }
+
+    // element by element fill(), for outputs that are not arrays of
+    // STORAGE such as character vectors
+    template <typename EXPR, typename Iterator>
+    inline void fill_elements( const EXPR& expr, Iterator out ){
+        R_xlen_t n = expr.size() ;
+        for( R_xlen_t i=0; i<n; i++, ++out ) *out = expr[i] ;
+    }
+
+} // kernels
+} // sugar
+} // Rcpp
+
+#endif
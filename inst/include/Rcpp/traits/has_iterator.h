@@ -93,6 +93,20 @@ namespace traits{
       static const bool value = sizeof(__test<T>(0)) == 1;
     };
 
+  template<typename T>
+  class _has_fill_kernel_helper : __sfinae_types {
+      template<typename U> struct _Wrap_type { };
+
+      template<typename U>
+        static __one __test(_Wrap_type<typename U::r_fill_kernel>*);
+
+      template<typename U>
+        static __two __test(...);
+
+    public:
+      static const bool value = sizeof(__test<T>(0)) == 1;
+    };
+
   /**
    * uses the SFINAE idiom to check if a class has an
    * nested iterator typedef. For example :
@@ -118,6 +132,16 @@ namespace traits{
   template<typename T> struct is_generator :
     integral_constant<bool,_is_generator_helper<T>::value> { };
 
+  /**
+   * sugar expressions whose typedef r_fill_kernel is true_type have a
+   * fill( out ) method writing all their elements at once
+   */
+  template<typename T, bool = _has_fill_kernel_helper<T>::value>
+  struct has_fill_kernel : false_type { };
+
+  template<typename T> struct has_fill_kernel<T,true> :
+    integral_constant<bool,T::r_fill_kernel::value> { };
+
 } // traits
 } // Rcpp
 
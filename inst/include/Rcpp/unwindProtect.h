@@ -46,14 +46,31 @@ inline SEXP unwindProtectUnwrap(void* data) {
     return (*callback)();
 }
 
+template <typename Fun>
+inline SEXP unwindProtectCall(void* data) {
+    Fun* callback = static_cast<Fun*>(data);
+    return (*callback)();
+}
+
+struct UnwindEvalData {
+    SEXP expr;
+    SEXP env;
+};
+
+inline SEXP unwindProtectEval(void* data) {
+    UnwindEvalData* eval_data = static_cast<UnwindEvalData*>(data);
+    return ::Rf_eval(eval_data->expr, eval_data->env);
+}
+
 }} // namespace Rcpp::internal
 
 
 namespace Rcpp {
 
-inline SEXP unwindProtect(SEXP (*callback)(void* data), void* data) {
+// The continuation token is kept protected by the caller and can be
+// reused for any number of calls.
+inline SEXP unwindProtect(SEXP (*callback)(void* data), void* data, SEXP token) {
     internal::UnwindData unwind_data;
-    Shield<SEXP> token(::R_MakeUnwindCont());
 
     if (setjmp(unwind_data.jmpbuf)) {
         // Keep the token protected while unwinding because R code might run
@@ -70,10 +87,88 @@ inline SEXP unwindProtect(SEXP (*callback)(void* data), void* data) {
                              token);
 }
 
+inline SEXP unwindProtect(SEXP (*callback)(void* data), void* data) {
+    Shield<SEXP> token(::R_MakeUnwindCont());
+    return unwindProtect(callback, data, token);
+}
+
 inline SEXP unwindProtect(std::function<SEXP(void)> callback) {
     return unwindProtect(&internal::unwindProtectUnwrap, &callback);
 }
 
+// Any callable returning SEXP, called without going through
+// std::function.
+template <typename Fun>
+inline SEXP unwindProtect(Fun callback) {
+    return unwindProtect(&internal::unwindProtectCall<Fun>, &callback);
+}
+
+// Owns one continuation token, preserved for its lifetime, and the jump
+// buffer, so that a loop evaluating R code many times does not allocate
+// a token per evaluation:
+//
+// UnwindScope scope;
+// for (...) {
+//     SEXP res = scope.eval(call, env);
+//     ...
+// }
+//
+// Evaluations nested inside one another through the same scope use a
+// jump buffer on the stack for all but the outermost one.
+class UnwindScope {
+public:
+    UnwindScope() : active(false) {
+        Shield<SEXP> cont(::R_MakeUnwindCont());
+        preserve_token = Rcpp_precious_preserve(cont);
+        token = cont;
+    }
+
+    ~UnwindScope() {
+        Rcpp_precious_remove(preserve_token);
+    }
+
+    SEXP operator()(SEXP (*callback)(void* data), void* data) {
+        if (active) {
+            return unwindProtect(callback, data, token);
+        }
+        active = true;
+        if (setjmp(unwind_data.jmpbuf)) {
+            active = false;
+            // see unwindProtect() above
+            ::R_PreserveObject(token);
+            throw LongjumpException(token);
+        }
+        SEXP res = ::R_UnwindProtect(callback, data,
+                                     internal::maybeJump, &unwind_data,
+                                     token);
+        active = false;
+        return res;
+    }
+
+    template <typename Fun>
+    SEXP operator()(Fun& callback) {
+        return (*this)(&internal::unwindProtectCall<Fun>, &callback);
+    }
+
+    // the equivalent of Rcpp_fast_eval(expr, env)
+    SEXP eval(SEXP expr, SEXP env) {
+        internal::UnwindEvalData data = { expr, env };
+        return (*this)(&internal::unwindProtectEval, &data);
+    }
+
+    SEXP get_token() const { return token; }
+
+private:
+    // not copyable, the token is released by the destructor
+    UnwindScope(const UnwindScope&);
+    UnwindScope& operator=(const UnwindScope&);
+
+    SEXP token;
+    SEXP preserve_token;
+    internal::UnwindData unwind_data;
+    bool active;
+};
+
 } // namespace Rcpp
 
 #endif
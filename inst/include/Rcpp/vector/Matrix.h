@@ -410,14 +410,10 @@ Matrix<RTYPE, StoragePolicy> tranpose_impl(const Matrix<RTYPE, StoragePolicy> &
     Vector<INTSXP, StoragePolicy> dims = ::Rf_getAttrib(x, R_DimSymbol);
     int nrow = dims[0], ncol = dims[1];
     MATRIX r(Dimension(ncol, nrow)); 	// new Matrix with reversed dimension
-    R_xlen_t len = XLENGTH(x), len2 = XLENGTH(x)-1;
 
-    // similar approach as in R: fill by in column, "accessing row-wise"
+    // walk the source in cache sized tiles rather than one full row at a time
     VECTOR s = VECTOR(r.get__());
-    for (R_xlen_t i = 0, j = 0; i < len; i++, j += nrow) {
-        if (j > len2) j -= len2;
-        s[i] = x[j];
-    }
+    internal::tiled_transpose(x.begin(), nrow, s.begin(), ncol, nrow, ncol);
 
     // there must be a simpler, more C++-ish way for this ...
     SEXP dimNames = Rf_getAttrib(x, R_DimNamesSymbol);
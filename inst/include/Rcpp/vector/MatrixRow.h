@@ -32,6 +32,8 @@ public:
     typedef typename MATRIX::Proxy reference ;
     typedef typename MATRIX::const_Proxy const_reference ;
     typedef typename MATRIX::value_type value_type ;
+    typedef typename MATRIX::stored_type stored_type ;
+    typedef typename MATRIX::iterator parent_iterator ;
 
     // We now have the structure to correct const-correctness, but without
     // major changes to the proxy mechanism, we cannot do it correctly.  As
@@ -150,18 +152,79 @@ public:
         row(other.row)
     {} ;
 
+    // the elements of a row are parent_nrow apart in the column major
+    // parent, so bulk operations walk them with a running stride instead
+    // of recomputing the parent index of each element
+
     template <int RT, bool NA, typename T>
     MatrixRow& operator=( const Rcpp::VectorBase<RT,NA,T>& rhs ){
         int n = size() ;
         const T& ref = rhs.get_ref() ;
-        RCPP_LOOP_UNROLL_LHSFUN(start,get_parent_index,ref)
-            return *this ;
+        parent_iterator out = start ;
+        for( int i=0; i<n; i++, out += parent_nrow ){
+            *out = ref[i] ;
+        }
+        return *this ;
     }
 
     MatrixRow& operator=( const MatrixRow& rhs ){
         int n = size() ;
-        RCPP_LOOP_UNROLL_LHSFUN(start,get_parent_index,rhs)
-            return *this ;
+        parent_iterator out = start, in = rhs.start ;
+        for( int i=0; i<n; i++, out += parent_nrow, in += rhs.parent_nrow ){
+            *out = *in ;
+        }
+        return *this ;
+    }
+
+#define RCPP_MATRIXROW_COMPOUND_OPERATOR(__OPERATOR__)                  \
+    template <int RT, bool NA, typename T>                              \
+    MatrixRow& operator __OPERATOR__ ( const Rcpp::VectorBase<RT,NA,T>& rhs ){ \
+        int n = size() ;                                                \
+        const T& ref = rhs.get_ref() ;                                  \
+        parent_iterator out = start ;                                   \
+        for( int i=0; i<n; i++, out += parent_nrow ){                   \
+            *out __OPERATOR__ ref[i] ;                                  \
+        }                                                               \
+        return *this ;                                                  \
+    }                                                                   \
+    MatrixRow& operator __OPERATOR__ ( const stored_type& rhs ){        \
+        int n = size() ;                                                \
+        parent_iterator out = start ;                                   \
+        for( int i=0; i<n; i++, out += parent_nrow ){                   \
+            *out __OPERATOR__ rhs ;                                     \
+        }                                                               \
+        return *this ;                                                  \
+    }
+
+    RCPP_MATRIXROW_COMPOUND_OPERATOR(+=)
+    RCPP_MATRIXROW_COMPOUND_OPERATOR(-=)
+    RCPP_MATRIXROW_COMPOUND_OPERATOR(*=)
+    RCPP_MATRIXROW_COMPOUND_OPERATOR(/=)
+
+#undef RCPP_MATRIXROW_COMPOUND_OPERATOR
+
+    /**
+     * copies the row into the contiguous range starting at out and
+     * returns the end of the written range
+     */
+    template <typename OutputIterator>
+    inline OutputIterator copy_to( OutputIterator out ) const {
+        return internal::strided_copy_from( start, parent_nrow, size(), out ) ;
+    }
+
+    /**
+     * overwrites the row with the size() elements starting at in
+     */
+    template <typename InputIterator>
+    inline MatrixRow& copy_from( InputIterator in ){
+        internal::strided_copy_to( in, start, parent_nrow, size() ) ;
+        return *this ;
+    }
+
+    template <typename U>
+    inline MatrixRow& fill( const U& u ){
+        fill__dispatch( typename traits::is_trivial<RTYPE>::type(), u ) ;
+        return *this ;
     }
 
     inline reference operator[]( int i ){
@@ -202,10 +265,30 @@ public:
 
 private:
     MATRIX& parent;
-    typename MATRIX::iterator start ;
+    parent_iterator start ;
     int parent_nrow ;
     int row ;
 
+    template <typename U>
+    void fill__dispatch( traits::false_type, const U& u ){
+        Shield<SEXP> elem( MATRIX::converter_type::get( u ) ) ;
+        int n = size() ;
+        parent_iterator out = start ;
+        for( int i=0; i<n; i++, out += parent_nrow ){
+            *out = ::Rf_duplicate( elem ) ;
+        }
+    }
+
+    template <typename U>
+    void fill__dispatch( traits::true_type, const U& u ){
+        stored_type value = MATRIX::converter_type::get( u ) ;
+        int n = size() ;
+        parent_iterator out = start ;
+        for( int i=0; i<n; i++, out += parent_nrow ){
+            *out = value ;
+        }
+    }
+
     inline R_xlen_t get_parent_index(int i) const {
         RCPP_DEBUG_4( "MatrixRow<%d>::get_parent_index(int = %d), parent_nrow = %d >> %d\n", RTYPE, i, parent_nrow, static_cast<R_xlen_t>(i) * parent_nrow )
         return static_cast<R_xlen_t>(i) * parent_nrow ;
@@ -313,6 +396,11 @@ public:
         return parent[ row + static_cast<R_xlen_t>(i) * parent_nrow ] ;
     }
 
+    template <typename OutputIterator>
+    inline OutputIterator copy_to( OutputIterator out ) const {
+        return internal::strided_copy_from( start, parent_nrow, size(), out ) ;
+    }
+
     inline const_iterator begin() const {
         return const_iterator( *this, 0 ) ;
     }
@@ -48,6 +48,92 @@ public:
 
     inline vec_iterator column_iterator( int j ) const { return iter + j*m_nr ; }
 
+    /**
+     * copies the block column by column into the contiguous range
+     * starting at out, i.e. in the layout of a nrow() x ncol() matrix
+     */
+    template <typename OutputIterator>
+    OutputIterator copy_to( OutputIterator out ) const {
+        for( R_xlen_t j=0; j<nc; j++ ){
+            out = std::copy( iter + j*m_nr, iter + j*m_nr + nr, out ) ;
+        }
+        return out ;
+    }
+
+    /**
+     * copies the block row by row into the contiguous range starting at
+     * out, i.e. in the layout of its ncol() x nrow() transpose. The
+     * strided reads are done in cache sized tiles so that visiting all
+     * rows of a large block costs about one pass over its memory.
+     */
+    template <typename OutputIterator>
+    OutputIterator transpose_to( OutputIterator out ) const {
+        internal::tiled_transpose( iter, m_nr, out, nc, nr, nc ) ;
+        return out + size() ;
+    }
+
+    /**
+     * overwrites the block with the size() column major elements
+     * starting at in
+     */
+    template <typename InputIterator>
+    SubMatrix& copy_from( InputIterator in ){
+        for( R_xlen_t j=0; j<nc; j++ ){
+            vec_iterator col = iter + j*m_nr ;
+            for( R_xlen_t i=0; i<nr; i++, ++in ){
+                col[i] = *in ;
+            }
+        }
+        return *this ;
+    }
+
+    /**
+     * overwrites the block with the size() row major elements starting
+     * at in, the reverse of transpose_to
+     */
+    template <typename InputIterator>
+    SubMatrix& transpose_from( InputIterator in ){
+        internal::tiled_transpose( in, nc, iter, m_nr, nc, nr ) ;
+        return *this ;
+    }
+
+    template <typename U>
+    SubMatrix& fill( const U& u ){
+        typename MATRIX::stored_type value = MATRIX::converter_type::get( u ) ;
+        for( R_xlen_t j=0; j<nc; j++ ){
+            std::fill( iter + j*m_nr, iter + j*m_nr + nr, value ) ;
+        }
+        return *this ;
+    }
+
+#define RCPP_SUBMATRIX_COMPOUND_OPERATOR(__OPERATOR__)                   \
+    SubMatrix& operator __OPERATOR__ ( const typename MATRIX::stored_type& rhs ){ \
+        for( R_xlen_t j=0; j<nc; j++ ){                                  \
+            vec_iterator col = iter + j*m_nr ;                           \
+            for( R_xlen_t i=0; i<nr; i++ ){                              \
+                col[i] __OPERATOR__ rhs ;                                \
+            }                                                            \
+        }                                                                \
+        return *this ;                                                   \
+    }                                                                    \
+    template <bool NA, typename MAT>                                     \
+    SubMatrix& operator __OPERATOR__ ( const MatrixBase<RTYPE,NA,MAT>& rhs ){ \
+        for( R_xlen_t j=0; j<nc; j++ ){                                  \
+            vec_iterator col = iter + j*m_nr ;                           \
+            for( R_xlen_t i=0; i<nr; i++ ){                              \
+                col[i] __OPERATOR__ rhs( i, j ) ;                        \
+            }                                                            \
+        }                                                                \
+        return *this ;                                                   \
+    }
+
+    RCPP_SUBMATRIX_COMPOUND_OPERATOR(+=)
+    RCPP_SUBMATRIX_COMPOUND_OPERATOR(-=)
+    RCPP_SUBMATRIX_COMPOUND_OPERATOR(*=)
+    RCPP_SUBMATRIX_COMPOUND_OPERATOR(/=)
+
+#undef RCPP_SUBMATRIX_COMPOUND_OPERATOR
+
 private:
     MATRIX& m ;
     vec_iterator iter ;
@@ -56,15 +142,7 @@ private:
 
 template <int RTYPE, template <class> class StoragePolicy >
 Matrix<RTYPE,StoragePolicy>::Matrix( const SubMatrix<RTYPE>& sub ) : VECTOR( Rf_allocMatrix( RTYPE, (int)sub.nrow(), (int)sub.ncol() )), nrows((int)sub.nrow()) {
-    R_xlen_t nc = sub.ncol() ;
-    iterator start = VECTOR::begin() ;
-	iterator rhs_it ;
-	for( R_xlen_t j=0; j<nc; j++){
-	    rhs_it = sub.column_iterator((int)j) ;
-	    for( int i=0; i<nrows; i++, ++start){
-	        *start = rhs_it[i] ;
-	    }
-	}
+    sub.copy_to( VECTOR::begin() ) ;
 }
 
 template <int RTYPE, template <class> class StoragePolicy >
@@ -74,14 +152,7 @@ Matrix<RTYPE,StoragePolicy>& Matrix<RTYPE,StoragePolicy>::operator=( const SubMa
         nrows = nr ;
         VECTOR::set__( Rf_allocMatrix( RTYPE, nr, nc ) ) ;
 	}
-	iterator start = VECTOR::begin() ;
-	iterator rhs_it ;
-	for( int j=0; j<nc; j++){
-	    rhs_it = sub.column_iterator(j) ;
-	    for( int i=0; i<nrows; i++, ++start){
-	        *start = rhs_it[i] ;
-	    }
-	}
+	sub.copy_to( VECTOR::begin() ) ;
 	return *this ;
 }
 
@@ -411,7 +411,12 @@ public:
         );
     }
 
-    Vector& sort(bool decreasing = false) {
+    // Integer, logical and numeric vectors are radix sorted, character
+    // vectors go through a most significant byte radix pass. Missing
+    // values end up where NAComparator puts them. With nthreads > 1
+    // the counting and scattering passes of large vectors are shared
+    // between threads.
+    Vector& sort(bool decreasing = false, int nthreads = 1) {
         // sort() does not apply to List, RawVector or ExpressionVector.
         //
         // The function below does nothing for qualified Vector types,
@@ -420,20 +425,7 @@ public:
         internal::Sort_is_not_allowed_for_this_type<RTYPE>::do_nothing();
 
         typename traits::storage_type<RTYPE>::type* start = internal::r_vector_start<RTYPE>( Storage::get__() );
-
-        if (!decreasing) {
-            std::sort(
-                start,
-                start + size(),
-                internal::NAComparator<typename traits::storage_type<RTYPE>::type>()
-            );
-        } else {
-            std::sort(
-                start,
-                start + size(),
-                internal::NAComparatorGreater<typename traits::storage_type<RTYPE>::type>()
-            );
-        }
+        internal::radix_sort( start, size(), decreasing, nthreads );
 
         return *this;
     }
@@ -1093,6 +1085,16 @@ private:
 
     template <typename T>
     inline void import_expression( const T& other, R_xlen_t n ) {
+        import_expression__impl( other, n, typename traits::has_fill_kernel<T>::type() ) ;
+    }
+
+    template <typename T>
+    inline void import_expression__impl( const T& other, R_xlen_t, traits::true_type ) {
+        other.fill( begin() ) ;
+    }
+
+    template <typename T>
+    inline void import_expression__impl( const T& other, R_xlen_t n, traits::false_type ) {
         iterator start = begin() ;
         RCPP_LOOP_UNROLL(start,other)
     }
@@ -0,0 +1,144 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// lazy_wrap.h: Rcpp R/C++ interface class library -- vectors computed on demand
+//
+// Copyright (C) 2026  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp__vector__lazy_wrap_h
+#define Rcpp__vector__lazy_wrap_h
+
+namespace Rcpp{
+namespace internal{
+
+    // The elements of a lazy vector. The ALTREP classes in the Rcpp
+    // library only see this interface; lazy_wrap() makes the concrete
+    // source in the calling package.
+    template <int RTYPE>
+    class LazyVectorSource {
+    public:
+        typedef typename traits::storage_type<RTYPE>::type STORAGE ;
+
+        virtual ~LazyVectorSource(){}
+        virtual R_xlen_t size() const = 0 ;
+        virtual STORAGE get( R_xlen_t i ) const = 0 ;
+
+        // elements [start, start + n) into buffer
+        virtual void get_region( R_xlen_t start, R_xlen_t n, STORAGE* buffer ) const = 0 ;
+    } ;
+
+    template <int RTYPE, typename Fun>
+    class LazyVectorFunction : public LazyVectorSource<RTYPE> {
+    public:
+        typedef typename traits::storage_type<RTYPE>::type STORAGE ;
+
+        LazyVectorFunction( R_xlen_t n_, const Fun& fun_ ) : n(n_), fun(fun_) {}
+
+        R_xlen_t size() const { return n ; }
+        STORAGE get( R_xlen_t i ) const { return fun(i) ; }
+        void get_region( R_xlen_t start, R_xlen_t count, STORAGE* buffer ) const {
+            for( R_xlen_t i=0; i<count; i++ ) buffer[i] = fun( start + i ) ;
+        }
+
+    private:
+        R_xlen_t n ;
+        Fun fun ;
+    } ;
+
+    // An address that tells the library it is compiled into: hidden, so
+    // that every shared library using Rcpp has its own
+    inline attribute_hidden const void* lazy_library(){
+        static const char token = 0 ;
+        return &token ;
+    }
+
+}
+
+    /**
+     * An R vector of length n whose element i is fun(i), computed when R
+     * asks for it. R code that only reads some elements, such as head() or
+     * x[i], or that reads them one at a time, never allocates the whole
+     * vector; it is made (once) when R needs its data pointer.
+     *
+     * The vector keeps fun alive until then, so fun must capture what it
+     * reads by value. Sugar expressions keep references to temporaries and
+     * cannot be captured themselves, but they can be rebuilt per element:
+     *
+     * // [[Rcpp::export]]
+     * SEXP scaled( NumericVector x, NumericVector y ){
+     *     return lazy_wrap<REALSXP>( x.size(), [x, y]( R_xlen_t i ){
+     *         return ( x * 2.0 + y )[i] ;
+     *     } ) ;
+     * }
+     *
+     * fun runs from inside R, so it must not call R and should not throw;
+     * exceptions become R errors. RTYPE is LGLSXP, INTSXP or REALSXP.
+     * Without ALTREP (R before 3.6.0) the vector is computed at once.
+     *
+     * Until it is computed, the vector calls fun, and deletes it, through
+     * code in the shared library of the calling package. That library
+     * must not be unloaded while the vector is pending, or R would call
+     * code that is no longer mapped: see materialize_lazy_vectors().
+     */
+    template <int RTYPE, typename Fun>
+    SEXP lazy_wrap( R_xlen_t n, Fun fun ){
+#if defined(RCPP_HAS_ALTREP)
+        internal::LazyVectorSource<RTYPE>* source = new internal::LazyVectorFunction<RTYPE,Fun>( n, fun ) ;
+        return internal::make_lazy_vector( RTYPE, source, internal::lazy_library() ) ;
+#else
+        Vector<RTYPE> res( no_init(n) ) ;
+        for( R_xlen_t i=0; i<n; i++ ) res[i] = fun(i) ;
+        return res ;
+#endif
+    }
+
+    /**
+     * Computes the lazy vectors not computed yet that were made by the
+     * calling library, and deletes their functions; those of other
+     * libraries stay lazy. sourceCpp() does so before unloading a library
+     * it built; a package returning lazy vectors should call it from its
+     * R_unload_<pkg>() routine:
+     *
+     * extern "C" void R_unload_mypackage( DllInfo* ){
+     *     Rcpp::materialize_lazy_vectors() ;
+     * }
+     *
+     * A function that throws leaves its vector full of NA. No warning is
+     * raised, as R may be unloading the library: the number of such
+     * vectors is returned for the caller to report.
+     */
+    inline attribute_hidden int materialize_lazy_vectors(){
+#if defined(RCPP_HAS_ALTREP)
+        return internal::compute_pending_lazy_vectors( internal::lazy_library() ) ;
+#else
+        return 0 ;
+#endif
+    }
+
+    /** whether x is a lazy vector not computed yet */
+    inline bool is_lazy( SEXP x ){
+#if defined(RCPP_HAS_ALTREP)
+        return internal::lazy_vector_pending( x ) ;
+#else
+        (void)x ;
+        return false ;
+#endif
+    }
+
+}
+
+#endif
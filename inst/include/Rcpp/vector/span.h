@@ -0,0 +1,151 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// span.h: Rcpp R/C++ interface class library -- borrowed views of vectors
+//
+// Copyright (C) 2026  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp__vector__span_h
+#define Rcpp__vector__span_h
+
+namespace Rcpp{
+
+    namespace internal{
+        // the R vector type whose elements are stored as T
+        template <typename T> struct span_rtype ;
+        template <> struct span_rtype<int>      { enum{ rtype = INTSXP } ; } ;
+        template <> struct span_rtype<double>   { enum{ rtype = REALSXP } ; } ;
+        template <> struct span_rtype<Rcomplex> { enum{ rtype = CPLXSXP } ; } ;
+        template <> struct span_rtype<Rbyte>    { enum{ rtype = RAWSXP } ; } ;
+
+        inline void span_check_type( SEXP x, int rtype ){
+            if( TYPEOF(x) != rtype ){
+                const char* fmt = "Expecting a %s vector: [type=%s]." ;
+                throw ::Rcpp::not_compatible( fmt, Rf_type2char(rtype), Rf_type2char(TYPEOF(x)) ) ;
+            }
+        }
+    }
+
+    /**
+     * A pointer and a size: the elements of a vector owned by somebody
+     * else. Unlike NumericVector and friends, making a span from a SEXP
+     * does not protect it and does not coerce it, it only checks its type
+     * and reads its length once. This suits arguments of exported
+     * functions, which R keeps alive for the duration of the call:
+     *
+     * // [[Rcpp::export]]
+     * double dot( span<const double> x, span<const double> y ){
+     *     if( x.size() != y.size() ) stop( "x and y must have the same length" ) ;
+     *     return std::inner_product( x.begin(), x.end(), y.begin(), 0.0 ) ;
+     * }
+     *
+     * Passing an integer vector where span<const double> is expected is an
+     * error. T can be int, double, Rcomplex or Rbyte, const or not; a span
+     * of non const elements writes into the R vector.
+     */
+    template <typename T>
+    class span {
+    public:
+        typedef T element_type ;
+        typedef typename traits::remove_const<T>::type value_type ;
+        typedef T* pointer ;
+        typedef T& reference ;
+        typedef T* iterator ;
+        typedef T* const_iterator ;
+        typedef R_xlen_t size_type ;
+
+        span() : start(0), n(0) {}
+        span( T* start_, R_xlen_t n_ ) : start(start_), n(n_) {}
+
+        explicit span( SEXP x ) : start(0), n(0) {
+            const int RTYPE = internal::span_rtype<value_type>::rtype ;
+            internal::span_check_type( x, RTYPE ) ;
+            n = Rf_xlength(x) ;
+            start = internal::r_vector_start<RTYPE>(x) ;
+        }
+
+        inline T* data() const { return start ; }
+        inline R_xlen_t size() const { return n ; }
+        inline bool empty() const { return n == 0 ; }
+
+        inline T& operator[]( R_xlen_t i ) const { return start[i] ; }
+        inline T& front() const { return start[0] ; }
+        inline T& back() const { return start[n-1] ; }
+
+        inline iterator begin() const { return start ; }
+        inline iterator end() const { return start + n ; }
+
+        /** the count elements from offset, or those up to the end */
+        inline span subspan( R_xlen_t offset, R_xlen_t count = -1 ) const {
+            if( offset < 0 || offset > n || count > n - offset ){
+                stop( "subspan out of range" ) ;
+            }
+            return span( start + offset, count < 0 ? n - offset : count ) ;
+        }
+
+    private:
+        T* start ;
+        R_xlen_t n ;
+    } ;
+
+    /**
+     * A read only view of an R vector of type RTYPE (LGLSXP, INTSXP,
+     * REALSXP, CPLXSXP or RAWSXP). Like span, it checks the type once and
+     * neither protects nor coerces, but it keeps the SEXP, so it can be
+     * handed back to R or to functions that want one.
+     *
+     * // [[Rcpp::export]]
+     * int count_true( ConstVectorView<LGLSXP> x ) ;
+     */
+    template <int RTYPE>
+    class ConstVectorView {
+    public:
+        typedef typename traits::storage_type<RTYPE>::type stored_type ;
+        typedef stored_type value_type ;
+        typedef const stored_type* iterator ;
+        typedef const stored_type* const_iterator ;
+
+        explicit ConstVectorView( SEXP x ) : object(x), start(0), n(0) {
+            internal::span_check_type( x, RTYPE ) ;
+            n = Rf_xlength(x) ;
+            start = internal::r_vector_start<RTYPE>(x) ;
+        }
+
+        inline const stored_type* data() const { return start ; }
+        inline R_xlen_t size() const { return n ; }
+        inline bool empty() const { return n == 0 ; }
+
+        inline const stored_type& operator[]( R_xlen_t i ) const { return start[i] ; }
+        inline iterator begin() const { return start ; }
+        inline iterator end() const { return start + n ; }
+
+        inline span<const stored_type> as_span() const {
+            return span<const stored_type>( start, n ) ;
+        }
+
+        inline SEXP get__() const { return object ; }
+        inline operator SEXP() const { return object ; }
+
+    private:
+        SEXP object ;
+        const stored_type* start ;
+        R_xlen_t n ;
+    } ;
+
+}
+
+#endif
@@ -0,0 +1,80 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// tiled.h: Rcpp R/C++ interface class library -- cache friendly strided copies
+//
+// Copyright (C) 2026  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp__vector__tiled_h
+#define Rcpp__vector__tiled_h
+
+// edge of the square tiles used when walking a column major block in
+// row major order, 32 doubles per side keeps a source and a target tile
+// comfortably inside L1
+#ifndef RCPP_TILE_SIZE
+#define RCPP_TILE_SIZE 32
+#endif
+
+namespace Rcpp{
+namespace internal{
+
+    // gather n elements that are 'stride' apart, e.g. one row of a
+    // column major matrix, into a contiguous output
+    template <typename InputIterator, typename OutputIterator>
+    inline OutputIterator strided_copy_from( InputIterator src, R_xlen_t stride, R_xlen_t n, OutputIterator out ){
+        for( R_xlen_t i=0; i<n; i++, ++out, src += stride ){
+            *out = *src ;
+        }
+        return out ;
+    }
+
+    // scatter n contiguous elements into positions 'stride' apart
+    template <typename InputIterator, typename OutputIterator>
+    inline InputIterator strided_copy_to( InputIterator in, OutputIterator dst, R_xlen_t stride, R_xlen_t n ){
+        for( R_xlen_t i=0; i<n; i++, ++in, dst += stride ){
+            *dst = *in ;
+        }
+        return in ;
+    }
+
+    // copies the nr x nc column major block starting at src (leading
+    // dimension src_ld) transposed into dst (leading dimension dst_ld),
+    // so that dst[ j + i * dst_ld ] = src[ i + j * src_ld ]. Both sides are
+    // walked in RCPP_TILE_SIZE square tiles so that each cache line that
+    // is loaded is fully used before it is evicted.
+    template <typename InputIterator, typename OutputIterator>
+    inline void tiled_transpose( InputIterator src, R_xlen_t src_ld, OutputIterator dst, R_xlen_t dst_ld, R_xlen_t nr, R_xlen_t nc ){
+        const R_xlen_t tile = RCPP_TILE_SIZE ;
+        for( R_xlen_t jj=0; jj<nc; jj += tile ){
+            R_xlen_t jmax = std::min( jj + tile, nc ) ;
+            for( R_xlen_t ii=0; ii<nr; ii += tile ){
+                R_xlen_t imax = std::min( ii + tile, nr ) ;
+                for( R_xlen_t j=jj; j<jmax; j++ ){
+                    InputIterator col = src + j * src_ld ;
+                    OutputIterator out = dst + j ;
+                    for( R_xlen_t i=ii; i<imax; i++ ){
+                        out[ i * dst_ld ] = col[i] ;
+                    }
+                }
+            }
+        }
+    }
+
+}
+}
+
+#endif
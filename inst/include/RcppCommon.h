@@ -158,14 +158,17 @@ namespace Rcpp {
 #include <Rcpp/traits/traits.h>
 #include <Rcpp/Named.h>
 
+#include <Rcpp/internal/parallel.h>
+#include <Rcpp/internal/radix.h>
+
 #include <Rcpp/internal/caster.h>
 #include <Rcpp/internal/r_vector.h>
 #include <Rcpp/r_cast.h>
 
 #include <Rcpp/api/bones/bones.h>
 
-#include <Rcpp/internal/export.h>
 #include <Rcpp/internal/r_coerce.h>
+#include <Rcpp/internal/export.h>
 #include <Rcpp/as.h>
 #include <Rcpp/InputParameter.h>
 #include <Rcpp/is.h>
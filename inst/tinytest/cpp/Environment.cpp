@@ -174,3 +174,24 @@ Environment runit_new_env_default() {
 Environment runit_new_env_parent(SEXP env) {
     return Rcpp::new_env(env);
 }
+
+// [[Rcpp::export]]
+double runit_symbol_binding(Environment env, int n) {
+    Environment::Binding counter = env[RCPP_SYMBOL("counter")];
+    for (int i = 0; i < n; i++) {
+        double value = counter;
+        counter = value + as<double>(env.get(RCPP_SYMBOL("step")));
+    }
+    return as<double>(env.get("counter"));
+}
+
+// [[Rcpp::export]]
+bool runit_symbol_remove(Environment env) {
+    return env.remove(RCPP_SYMBOL("counter"));
+}
+
+// [[Rcpp::export]]
+SEXP runit_symbol_function(Environment env) {
+    Function f(RCPP_SYMBOL("twice"), env);
+    return f(21);
+}
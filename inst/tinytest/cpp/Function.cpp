@@ -80,3 +80,23 @@ Function function_namespace_env(){
 // [[Rcpp::export]]
 void exec(Function f) { f(); }
 
+
+// [[Rcpp::export]]
+NumericVector function_prepared(Function f, NumericVector x, double y) {
+    PreparedCall call(f, 0.0, Named("y") = y);
+    NumericVector res(x.size());
+    for (R_xlen_t i = 0; i < x.size(); i++) {
+        res[i] = as<double>(call(x[i]));
+    }
+    return res;
+}
+
+// [[Rcpp::export]]
+List function_prepared_keep(Function f, NumericVector x) {
+    PreparedCall call(f, 0.0);
+    List res(x.size());
+    for (R_xlen_t i = 0; i < x.size(); i++) {
+        res[i] = call(x[i]);
+    }
+    return res;
+}
@@ -453,3 +453,52 @@ Rcpp::CharacterMatrix char_diag_fill(Rcpp::CharacterMatrix x, std::string diag_v
     x.fill_diag(diag_val);
     return x;
 }
+
+// --- Bulk row and block operations
+
+// [[Rcpp::export]]
+NumericVector row_copy_to(NumericMatrix m, int i) {
+    NumericVector out(m.ncol());
+    m.row(i).copy_to(out.begin());
+    return out;
+}
+
+// [[Rcpp::export]]
+NumericMatrix row_copy_from(NumericMatrix m, int i, NumericVector x) {
+    m.row(i).copy_from(x.begin());
+    return m;
+}
+
+// [[Rcpp::export]]
+NumericMatrix row_fill_and_update(NumericMatrix m, int i, double value, NumericVector x) {
+    NumericMatrix::Row r = m.row(i);
+    r.fill(value);
+    r += x;
+    r *= 2.0;
+    return m;
+}
+
+// [[Rcpp::export]]
+NumericVector submat_transpose_to(NumericMatrix m, int r0, int r1, int c0, int c1) {
+    NumericMatrix::Sub s = m(Range(r0, r1), Range(c0, c1));
+    NumericVector out(s.size());
+    s.transpose_to(out.begin());
+    return out;
+}
+
+// [[Rcpp::export]]
+NumericMatrix submat_transpose_from(NumericMatrix m, int r0, int r1, int c0, int c1, NumericVector x) {
+    m(Range(r0, r1), Range(c0, c1)).transpose_from(x.begin());
+    return m;
+}
+
+// [[Rcpp::export]]
+NumericMatrix submat_scale(NumericMatrix m, int r0, int r1, int c0, int c1, double value) {
+    m(Range(r0, r1), Range(c0, c1)) *= value;
+    return m;
+}
+
+// [[Rcpp::export]]
+CharacterMatrix character_transpose(CharacterMatrix m) {
+    return transpose(m);
+}
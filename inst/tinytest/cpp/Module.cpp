@@ -111,6 +111,28 @@ private:
     double min, max;
 };
 
+RCPP_EXPOSED_CLASS(ModuleCounter)
+class ModuleCounter {
+public:
+    ModuleCounter() : count(0), step(1) {}
+    ModuleCounter(int step_) : count(0), step(step_) {}
+    void add() { count += step; }
+    int get() const { return count; }
+    int plus(IntegerVector x) const { return count + sum(x); }
+    ModuleCounter twice() const {
+        ModuleCounter res(2 * step);
+        res.count = 2 * count;
+        return res;
+    }
+
+    int count;
+    int step;
+};
+
+int ModuleCounter_get(const ModuleCounter& x) {
+    return x.count;
+}
+
 RCPP_EXPOSED_CLASS(ModuleTest)
 class ModuleTest {
 public:
@@ -194,6 +216,32 @@ RCPP_MODULE(demoModule) {
 
         .method("get" , &ModuleRandomizer::get)
         ;
+
+    class_<ModuleCounter>("ModuleCounter")
+        .lightweight()
+        .constructor()
+        .constructor<int>()
+        .method("add", &ModuleCounter::add)
+        .method("get", &ModuleCounter::get)
+        .method("plus", &ModuleCounter::plus)
+        .method("twice", &ModuleCounter::twice)
+        .field("count", &ModuleCounter::count)
+        .field_readonly("step", &ModuleCounter::step)
+        ;
+
+    function("ModuleCounter_get", ModuleCounter_get);
+}
+
+// [[Rcpp::export]]
+SEXP ModuleNumber_vector(int n) {
+    std::vector<ModuleNumber>* v = new std::vector<ModuleNumber>(n);
+    for (int i = 0; i < n; i++) (*v)[i].y = i;
+    return object_vector_xptr(v);
+}
+
+// [[Rcpp::export]]
+SEXP ModuleNumber_xptr() {
+    return XPtr<ModuleNumber>(new ModuleNumber);
 }
 
 // [[Rcpp::export]]
@@ -149,3 +149,26 @@ String test_String_embeddedNul() {
     std::string bad("abc\0abc", 7);
     return String(bad);
 }
+
+// [[Rcpp::export]]
+CharacterVector test_StringBuilder_rows(IntegerVector id, NumericVector value, CharacterVector name) {
+    R_xlen_t n = id.size();
+    CharacterVector out(n);
+    StringBuilder sb(64);
+    for (R_xlen_t i = 0; i < n; i++) {
+        sb.clear();
+        sb << "{\"id\":" << id[i] << ",\"value\":" << value[i] << ",\"name\":\"" << name[i] << "\"}";
+        out[i] = sb.get_sexp();
+    }
+    return out;
+}
+
+// [[Rcpp::export]]
+SEXP test_StringBuilder_wrap(CharacterVector x) {
+    StringBuilder sb;
+    for (R_xlen_t i = 0; i < x.size(); i++) {
+        if (i) sb << ',';
+        sb << x[i];
+    }
+    return wrap(sb);
+}
@@ -782,6 +782,31 @@ LogicalVector sort_logical_desc(LogicalVector x) {
     return x.sort(true);
 }
 
+// [[Rcpp::export]]
+NumericVector sort_numeric_threads(NumericVector x, bool decreasing, int nthreads) {
+    return clone(x).sort(decreasing, nthreads);
+}
+
+// [[Rcpp::export]]
+IntegerVector sort_integer_threads(IntegerVector x, bool decreasing, int nthreads) {
+    return clone(x).sort(decreasing, nthreads);
+}
+
+// [[Rcpp::export]]
+IntegerVector order_numeric(NumericVector x, bool decreasing) {
+    return order(x, decreasing);
+}
+
+// [[Rcpp::export]]
+IntegerVector order_character(CharacterVector x, bool decreasing) {
+    return order(x, decreasing);
+}
+
+// [[Rcpp::export]]
+IntegerVector sort_index_integer(IntegerVector x, int nthreads) {
+    return sort_index(x, false, nthreads);
+}
+
 // [[Rcpp::export]]
 List list_sexp_assign(SEXP x) {
     List L;
@@ -900,3 +925,68 @@ NumericVector vec_copy(NumericVector vec1) {
     std::copy(vec1.begin(), vec1.end(), vec2.begin());
     return vec2;
 }
+
+// [[Rcpp::export]]
+double span_dot(span<const double> x, span<const double> y) {
+    if (x.size() != y.size()) stop("x and y must have the same length");
+    double res = 0.0;
+    for (R_xlen_t i = 0; i < x.size(); i++) res += x[i] * y[i];
+    return res;
+}
+
+// [[Rcpp::export]]
+int span_sum_int(const span<const int>& x) {
+    int res = 0;
+    for (span<const int>::iterator it = x.begin(); it != x.end(); ++it) res += *it;
+    return res;
+}
+
+// [[Rcpp::export]]
+NumericVector span_tail(span<const double> x, int offset) {
+    return wrap(x.subspan(offset));
+}
+
+// [[Rcpp::export]]
+int view_count_true(ConstVectorView<LGLSXP> x) {
+    int n = 0;
+    for (R_xlen_t i = 0; i < x.size(); i++) n += x[i] == TRUE;
+    return n;
+}
+
+// [[Rcpp::export]]
+SEXP view_identity(ConstVectorView<REALSXP> x) {
+    return x;
+}
+
+struct lazy_affine {
+    NumericVector x, y;
+    lazy_affine(NumericVector x_, NumericVector y_) : x(x_), y(y_) {}
+    double operator()(R_xlen_t i) const { return (x * 2.0 + y)[i]; }
+};
+
+// [[Rcpp::export]]
+SEXP lazy_affine_vector(NumericVector x, NumericVector y) {
+    return lazy_wrap<REALSXP>(x.size(), lazy_affine(x, y));
+}
+
+struct lazy_failing {
+    int operator()(R_xlen_t i) const {
+        if (i == 2) stop("no element 3");
+        return static_cast<int>(i);
+    }
+};
+
+// [[Rcpp::export]]
+SEXP lazy_failing_vector() {
+    return lazy_wrap<INTSXP>(3, lazy_failing());
+}
+
+// [[Rcpp::export]]
+bool lazy_pending(SEXP x) {
+    return is_lazy(x);
+}
+
+// [[Rcpp::export]]
+int lazy_materialize_all() {
+    return materialize_lazy_vectors();
+}
@@ -58,3 +58,28 @@ std::deque<int> as_deque_int( SEXP x){ return as< std::deque<int> >(x) ; }
 // [[Rcpp::export]]
 std::list<int> as_list_int( SEXP x){ return as< std::list<int> >(x) ; }
 
+
+// [[Rcpp::export]]
+std::vector<float> as_vector_float( SEXP x){ return as< std::vector<float> >(x) ; }
+
+// [[Rcpp::export]]
+std::vector<int> as_vector_int_na_replace( SEXP x, int value){
+    return as_with_na< std::vector<int> >(x, ExportNA<int>::replace(value)) ;
+}
+
+// [[Rcpp::export]]
+std::vector<double> as_vector_double_na_stop( SEXP x){
+    return as_with_na< std::vector<double> >(x, ExportNA<double>::stop()) ;
+}
+
+// [[Rcpp::export]]
+ComplexVector as_vector_complex( SEXP x){
+    std::vector< std::complex<double> > y = as< std::vector< std::complex<double> > >(x) ;
+    std::vector<Rcomplex> z = as< std::vector<Rcomplex> >(x) ;
+    ComplexVector res( y.size() ) ;
+    for( size_t i=0; i<y.size(); i++ ){
+        res[i].r = y[i].real() ;
+        res[i].i = z[i].i ;
+    }
+    return res ;
+}
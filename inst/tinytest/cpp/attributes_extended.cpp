@@ -47,3 +47,37 @@ void test_invisible_uppercase_true() {
 
 // [[Rcpp::export(name = "test.with.dots")]]
 int test_cpp_name_conversion() { return 999; }
+
+// Test 4.6: Fast wrappers
+
+// [[Rcpp::export(fast = true)]]
+double test_fast_add(double x, double y) { return x + y; }
+
+// [[Rcpp::export(fast = true)]]
+SEXP test_fast_identity(SEXP x) noexcept { return x; }
+
+// [[Rcpp::export(fast = TRUE)]]
+void test_fast_void(int x) {
+    if (x < 0) Rcpp::stop("negative");
+}
+
+// [[Rcpp::export(fast = true)]]
+double test_fast_throw(NumericVector x) {
+    if (x.size() == 0) Rcpp::stop("empty");
+    return x[0];
+}
+
+// [[Rcpp::export(fast = true, rng = true)]]
+double test_fast_rng() { return R::unif_rand(); }
+
+// Test 4.7: Argument checks
+
+// [[Rcpp::export(check = true)]]
+double test_check_args(double x, NumericVector v, std::string s, Rcpp::Nullable<IntegerVector> n = R_NilValue) {
+    return x + v.size() + s.size() + (n.isNull() ? 0 : 1);
+}
+
+// [[Rcpp::export(check = true, fast = true)]]
+double test_check_fast(Rcpp::span<const double> x) {
+    return x.size() ? x[0] : 0.0;
+}
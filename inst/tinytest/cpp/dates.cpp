@@ -146,6 +146,12 @@ SEXP Datetime_from_string(std::string x) {
     return wrap(dt);
 }
 
+// [[Rcpp::export]]
+SEXP Datetime_from_string_format(std::string x, std::string fmt) {
+    Datetime dt(x, fmt);
+    return wrap(dt);
+}
+
 // [[Rcpp::export]]
 SEXP Datetime_ctor_sexp(Datetime d) {
     Datetime dt = Datetime(d);
@@ -253,3 +259,41 @@ Rcpp::DateVector default_ctor_datevector() {
 Rcpp::DatetimeVector default_ctor_datetimevector() {
     return Rcpp::DatetimeVector();
 }
+
+// [[Rcpp::export]]
+Rcpp::DateVector parse_date_threads(Rcpp::CharacterVector x, std::string fmt, int nthreads) {
+    return Rcpp::parse_date(x, fmt, nthreads);
+}
+
+// [[Rcpp::export]]
+Rcpp::DatetimeVector parse_datetime_threads(Rcpp::CharacterVector x, std::string fmt, int nthreads) {
+    return Rcpp::parse_datetime(x, fmt, nthreads);
+}
+
+// [[Rcpp::export]]
+Rcpp::CharacterVector format_date_threads(Rcpp::NumericVector x, std::string fmt, int nthreads) {
+    return Rcpp::format_date(x, fmt, nthreads);
+}
+
+// [[Rcpp::export]]
+Rcpp::CharacterVector format_datetime_threads(Rcpp::NumericVector x, std::string fmt, int nthreads) {
+    return Rcpp::format_datetime(x, fmt, nthreads);
+}
+
+// [[Rcpp::export]]
+Rcpp::List date_fields(Rcpp::newDateVector d, int nthreads) {
+    return Rcpp::List::create(Rcpp::Named("year") = d.year(nthreads),
+                              Rcpp::Named("mon")  = d.month(nthreads),
+                              Rcpp::Named("mday") = d.mday(nthreads),
+                              Rcpp::Named("wday") = d.wday(nthreads),
+                              Rcpp::Named("yday") = d.yday(nthreads));
+}
+
+// [[Rcpp::export]]
+Rcpp::List datetime_fields(Rcpp::newDatetimeVector d, int nthreads) {
+    return Rcpp::List::create(Rcpp::Named("year") = d.year(nthreads),
+                              Rcpp::Named("yday") = d.yday(nthreads),
+                              Rcpp::Named("hour") = d.hour(nthreads),
+                              Rcpp::Named("min")  = d.minute(nthreads),
+                              Rcpp::Named("sec")  = d.second(nthreads));
+}
@@ -96,3 +96,14 @@ SEXP testUnwindProtectFunctionObject(Environment indicator, bool fail) {
     out = Rcpp::unwindProtect(FunctionObj(10, fail));
     return out;
 }
+
+// [[Rcpp::export]]
+SEXP testUnwindScope(RObject expr, Environment env, Environment indicator, int n) {
+    unwindIndicator my_data(indicator);
+    UnwindScope scope;
+    SEXP out = R_NilValue;
+    for (int i = 0; i < n; i++) {
+        out = scope.eval(expr, env);
+    }
+    return out;
+}
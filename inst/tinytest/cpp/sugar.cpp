@@ -274,6 +274,49 @@ List runit_mapply2_list(IntegerVector xx, IntegerVector yy){
     return res ;
 }
 
+// [[Rcpp::export]]
+List runit_vmap( NumericVector xx, int nthreads ){
+    return List::create(
+        _["real"] = vmap( xx, [](double x) { return x * x; }, nthreads ),
+        _["logical"] = vmap( xx * 2.0, [](double x) { return x > 10; }, nthreads ),
+        _["string"] = vmap( xx, [](double x) { return std::string( x > 5 ? "big" : "small" ); }, nthreads ),
+        _["list"] = vmap( xx, [](double x) { return seq_len( static_cast<int>(x) ); }, nthreads ),
+        _["frame"] = vmap( xx, [](double x) { return std::make_tuple( x, static_cast<int>(x) % 3, x > 5 ); }, nthreads ),
+        _["vmap2"] = vmap2( xx, seq_along( xx ), [](double x, int i) { return x * i; }, nthreads )
+    ) ;
+}
+
+// [[Rcpp::export]]
+List runit_roll( NumericVector xx, int width, std::string align, bool partial, bool na_rm, int nthreads ){
+    const char* a = align.c_str() ;
+    return List::create(
+        _["sum"] = NumericVector( roll_sum( xx, width, a, partial, na_rm, nthreads ) ),
+        _["mean"] = NumericVector( roll_mean( xx, width, a, partial, na_rm, nthreads ) ),
+        _["var"] = NumericVector( roll_var( xx, width, a, partial, na_rm, nthreads ) ),
+        _["min"] = NumericVector( roll_min( xx, width, a, partial, na_rm, nthreads ) ),
+        _["max"] = NumericVector( roll_max( xx, width, a, partial, na_rm, nthreads ) )
+    ) ;
+}
+
+// [[Rcpp::export]]
+List runit_group_by( SEXP keys, NumericVector xx, bool na_rm, int nthreads ){
+    sugar::GroupBy g = group_by( keys, nthreads ) ;
+    return List::create(
+        _["ids"] = g.group_ids(),
+        _["keys"] = g.group_keys(),
+        _["count"] = g.count(),
+        _["sum"] = g.sum( xx, na_rm ),
+        _["mean"] = g.mean( xx, na_rm ),
+        _["min"] = g.min( xx, na_rm ),
+        _["max"] = g.max( xx, na_rm )
+    ) ;
+}
+
+// [[Rcpp::export]]
+List runit_hash_join( DataFrame left, DataFrame right, CharacterVector by, std::string type, int nthreads ){
+    return hash_join( left, right, by, type.c_str(), nthreads ) ;
+}
+
 // [[Rcpp::export]]
 List runit_minus( IntegerVector xx ){
     return List::create(
@@ -396,6 +439,29 @@ List runit_pmax_one( NumericVector xx ){
     	) ;
 }
 
+// [[Rcpp::export]]
+List runit_kernels_inplace( NumericVector xx, NumericVector yy, LogicalVector pred ){
+    NumericVector a = clone( xx ), b = clone( xx ), c = clone( xx ) ;
+    a = pmin( a, yy ) ;
+    b = ifelse( pred, b, yy ) ;
+    c = clamp( -1.0, c, 1.0 ) ;
+    return List::create( a, b, c ) ;
+}
+
+// [[Rcpp::export]]
+List runit_kernels_int( IntegerVector xx, IntegerVector yy, LogicalVector pred ){
+    IntegerVector a = clone( xx ) ;
+    a = ifelse( pred, a, yy ) ;
+    return List::create( ifelse( pred, xx, yy ), ifelse( pred, 7, yy ),
+                         ifelse( pred, xx, 8 ), a, ifelse( xx > yy, xx, yy ),
+                         pmin( xx, yy ), pmax( xx, yy ), pmax( xx, 4 ), clamp( 2, xx, 4 ) ) ;
+}
+
+// [[Rcpp::export]]
+List runit_kernels_character( CharacterVector xx, CharacterVector yy, LogicalVector pred ){
+    return List::create( ifelse( pred, xx, yy ), ifelse( pred, xx, rev( yy ) ) ) ;
+}
+
 // [[Rcpp::export]]
 NumericVector runit_Range(){
     NumericVector xx(8) ;
@@ -572,6 +638,16 @@ NumericMatrix runit_outer_lambda(NumericVector xx, NumericVector yy){
     return m ;
 }
 
+// [[Rcpp::export]]
+NumericMatrix runit_outer_threads(NumericVector xx, NumericVector yy, int nthreads){
+    return outer(xx, yy, [](double x, double y) { return x * y; }, nthreads);
+}
+
+// [[Rcpp::export]]
+NumericMatrix runit_outer_symmetric(NumericVector xx, int nthreads){
+    return outer_symmetric(xx, [](double x, double y) { return std::abs(x - y); }, nthreads);
+}
+
 // [[Rcpp::export]]
 List runit_row( NumericMatrix xx ){
     return List::create(
@@ -766,6 +842,22 @@ LogicalVector runit_duplicated( CharacterVector x){
     return duplicated( x ) ;
 }
 
+// [[Rcpp::export]]
+List runit_hash_threads( NumericVector x, int nthreads ){
+    return List::create(
+        _["unique"] = unique( x, nthreads ),
+        _["duplicated"] = duplicated( x, nthreads ),
+        _["self_match"] = self_match( x, nthreads ),
+        _["match"] = match( x, unique( x ), nthreads ),
+        _["match_long"] = match_long( x, unique( x ), nthreads )
+    ) ;
+}
+
+// [[Rcpp::export]]
+IntegerVector runit_match_dbl( NumericVector x, NumericVector table ){
+    return match( x, table ) ;
+}
+
 // [[Rcpp::export]]
 IntegerVector runit_union( IntegerVector x, IntegerVector y){
     return union_( x, y) ;
@@ -776,6 +868,11 @@ IntegerVector runit_setdiff( IntegerVector x, IntegerVector y){
     return setdiff( x, y) ;
 }
 
+// [[Rcpp::export]]
+NumericVector runit_setdiff_dbl( NumericVector x, NumericVector y){
+    return setdiff( x, y) ;
+}
+
 // [[Rcpp::export]]
 bool runit_setequal_integer(IntegerVector x, IntegerVector y) {
     return setequal(x, y);
@@ -791,6 +888,22 @@ IntegerVector runit_intersect( IntegerVector x, IntegerVector y){
     return intersect( x, y ) ;
 }
 
+// [[Rcpp::export]]
+CharacterVector runit_intersect_chr( CharacterVector x, CharacterVector y){
+    return intersect( x, y ) ;
+}
+
+// the strings of the sapply() expressions only live in the vectors they
+// are materialized into
+// [[Rcpp::export]]
+List runit_set_expressions( IntegerVector x, IntegerVector y){
+    auto label = []( int i ){ return std::string( "k" ) + std::to_string( i ) ; } ;
+    return List::create( union_( sapply( x, label ), sapply( y, label ) ),
+                         setdiff( sapply( x, label ), sapply( y, label ) ),
+                         intersect( sapply( x, label ), sapply( y, label ) ),
+                         setequal( sapply( x, label ), sapply( rev( x ), label ) ) ) ;
+}
+
 // [[Rcpp::export]]
 NumericVector runit_clamp( double a, NumericVector x, double b){
     return clamp( a, x, b ) ;
@@ -916,6 +1029,33 @@ Rcpp::String median_ch(Rcpp::CharacterVector x, bool na_rm = false) {
     return Rcpp::median(x, na_rm);
 }
 
+// [[Rcpp::export]]
+Rcpp::NumericVector quantile_dbl(Rcpp::NumericVector x, Rcpp::NumericVector probs, int type, bool na_rm = false) {
+    return Rcpp::quantile(x, probs, type, na_rm);
+}
+
+// [[Rcpp::export]]
+Rcpp::NumericVector quantile_int(Rcpp::IntegerVector x, Rcpp::NumericVector probs, int type, bool na_rm = false) {
+    return Rcpp::quantile(x, probs, type, na_rm);
+}
+
+// [[Rcpp::export]]
+Rcpp::NumericVector quantile_sketch(Rcpp::NumericVector x, Rcpp::NumericVector probs, double compression) {
+    Rcpp::sugar::QuantileSketch sketch(compression);
+    sketch.push(x);
+    return sketch.quantile(probs);
+}
+
+// [[Rcpp::export]]
+Rcpp::NumericVector quantile_sketch_merge(Rcpp::NumericVector x, Rcpp::LogicalVector first, Rcpp::NumericVector probs) {
+    Rcpp::sugar::QuantileSketch a, b;
+    for (R_xlen_t i = 0; i < x.size(); i++) {
+        if (first[i]) a.push(x[i]); else b.push(x[i]);
+    }
+    a.merge(b);
+    return a.quantile(probs);
+}
+
 
 // 12 March 2016: cbind
 // A. Numeric*
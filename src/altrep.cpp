@@ -0,0 +1,374 @@
+// altrep.cpp: Rcpp R/C++ interface class library -- ALTREP classes of lazy vectors
+//
+// Copyright (C) 2026  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#define COMPILING_RCPP
+
+#if defined(_WIN32)
+#  define WIN32_LEAN_AND_MEAN
+#  include <windows.h>
+#else
+#  include <dlfcn.h>
+#  include <stdlib.h>
+#endif
+
+#include <Rcpp.h>
+#include "internal.h"
+
+#if defined(RCPP_HAS_ALTREP)
+
+// A lazy vector keeps its LazyVectorSource in an external pointer in data1
+// and, once computed, the ordinary vector holding its elements in data2.
+// Computing it drops data1 and deletes the source at once: its code is in
+// the library of the package that made it, which may be unloaded later.
+
+namespace Rcpp {
+namespace internal {
+
+    static R_altrep_class_t lazy_real_class;
+    static R_altrep_class_t lazy_integer_class;
+    static R_altrep_class_t lazy_logical_class;
+
+    // Weak references to the lazy vectors made so far, keyed on their
+    // external pointers, in the CDR of this preserved cell, so that
+    // compute_pending_lazy_vectors() can find those still pending. The
+    // tag of each cell holds the address identifying the library that
+    // made the vector. The references to vectors computed or collected
+    // are dropped when the list has doubled since the last time.
+    static SEXP lazy_registry = NULL;
+    static R_xlen_t lazy_registered = 0;
+    static R_xlen_t lazy_prune_at = 64;
+
+    // C++ exceptions must not cross R's C frames: the message is copied
+    // here before raising the R error outside of the catch block
+    static char lazy_error_buffer[512];
+
+    static void lazy_error() {
+        Rf_error("%s", lazy_error_buffer);
+    }
+
+    static void lazy_record_error(const char* message) {
+        std::strncpy(lazy_error_buffer, message, sizeof(lazy_error_buffer) - 1);
+        lazy_error_buffer[sizeof(lazy_error_buffer) - 1] = '\0';
+    }
+
+    template <int RTYPE>
+    static void lazy_finalizer(SEXP xp) {
+        LazyVectorSource<RTYPE>* source = static_cast<LazyVectorSource<RTYPE>*>(R_ExternalPtrAddr(xp));
+        if (source == NULL) return;
+        R_ClearExternalPtr(xp);
+        delete source;
+    }
+
+    template <int RTYPE>
+    static LazyVectorSource<RTYPE>* lazy_source(SEXP x) {
+        return static_cast<LazyVectorSource<RTYPE>*>(R_ExternalPtrAddr(R_altrep_data1(x)));
+    }
+
+    // Computes the elements of x into data2 and deletes its source. When
+    // the source throws, x is left pending and false returned, or with
+    // na_on_error its elements are all NA.
+    template <int RTYPE>
+    static bool lazy_compute(SEXP x, bool na_on_error) {
+        typedef typename traits::storage_type<RTYPE>::type STORAGE;
+        SEXP xp = PROTECT(R_altrep_data1(x));
+        LazyVectorSource<RTYPE>* source = lazy_source<RTYPE>(x);
+        R_xlen_t n = source->size();
+        SEXP data = PROTECT(Rf_allocVector(RTYPE, n));
+        STORAGE* start = reinterpret_cast<STORAGE*>(DATAPTR(data));
+        bool ok = true;
+        try {
+            source->get_region(0, n, start);
+        } catch (std::exception& e) {
+            lazy_record_error(e.what());
+            ok = false;
+        } catch (...) {
+            lazy_record_error("c++ exception (unknown reason)");
+            ok = false;
+        }
+        if (!ok) {
+            if (!na_on_error) {
+                UNPROTECT(2);
+                return false;
+            }
+            std::fill(start, start + n, traits::get_na<RTYPE>());
+        }
+        R_set_altrep_data2(x, data);
+        R_set_altrep_data1(x, R_NilValue);
+        lazy_finalizer<RTYPE>(xp);
+        UNPROTECT(2);
+        return ok;
+    }
+
+    template <int RTYPE>
+    static SEXP lazy_materialize(SEXP x) {
+        if (R_altrep_data2(x) == R_NilValue && !lazy_compute<RTYPE>(x, false)) {
+            lazy_error();
+        }
+        return R_altrep_data2(x);
+    }
+
+    template <int RTYPE>
+    static R_xlen_t lazy_Length(SEXP x) {
+        SEXP data = R_altrep_data2(x);
+        if (data != R_NilValue) return XLENGTH(data);
+        return lazy_source<RTYPE>(x)->size();
+    }
+
+    template <int RTYPE>
+    static Rboolean lazy_Inspect(SEXP x, int, int, int, void (*)(SEXP, int, int, int)) {
+        Rprintf("Rcpp lazy %s vector (%s)\n", Rf_type2char(RTYPE),
+                R_altrep_data2(x) == R_NilValue ? "pending" : "computed");
+        return TRUE;
+    }
+
+    template <int RTYPE>
+    static void* lazy_Dataptr(SEXP x, Rboolean) {
+        return DATAPTR(lazy_materialize<RTYPE>(x));
+    }
+
+    static const void* lazy_Dataptr_or_null(SEXP x) {
+        SEXP data = R_altrep_data2(x);
+        return data == R_NilValue ? NULL : DATAPTR(data);
+    }
+
+    template <int RTYPE>
+    static typename traits::storage_type<RTYPE>::type lazy_Elt(SEXP x, R_xlen_t i) {
+        typedef typename traits::storage_type<RTYPE>::type STORAGE;
+        SEXP data = R_altrep_data2(x);
+        if (data != R_NilValue) return reinterpret_cast<STORAGE*>(DATAPTR(data))[i];
+        bool ok = true;
+        STORAGE res = STORAGE();
+        try {
+            res = lazy_source<RTYPE>(x)->get(i);
+        } catch (std::exception& e) {
+            lazy_record_error(e.what());
+            ok = false;
+        } catch (...) {
+            lazy_record_error("c++ exception (unknown reason)");
+            ok = false;
+        }
+        if (!ok) lazy_error();
+        return res;
+    }
+
+    template <int RTYPE>
+    static R_xlen_t lazy_Get_region(SEXP x, R_xlen_t start, R_xlen_t size,
+                                    typename traits::storage_type<RTYPE>::type* buffer) {
+        typedef typename traits::storage_type<RTYPE>::type STORAGE;
+        R_xlen_t n = lazy_Length<RTYPE>(x);
+        if (start >= n) return 0;
+        R_xlen_t count = std::min(size, n - start);
+        SEXP data = R_altrep_data2(x);
+        if (data != R_NilValue) {
+            const STORAGE* from = reinterpret_cast<STORAGE*>(DATAPTR(data)) + start;
+            std::copy(from, from + count, buffer);
+            return count;
+        }
+        bool ok = true;
+        try {
+            lazy_source<RTYPE>(x)->get_region(start, count, buffer);
+        } catch (std::exception& e) {
+            lazy_record_error(e.what());
+            ok = false;
+        } catch (...) {
+            lazy_record_error("c++ exception (unknown reason)");
+            ok = false;
+        }
+        if (!ok) lazy_error();
+        return count;
+    }
+
+    template <int RTYPE>
+    static void lazy_set_common_methods(R_altrep_class_t cls) {
+        R_set_altrep_Length_method(cls, lazy_Length<RTYPE>);
+        R_set_altrep_Inspect_method(cls, lazy_Inspect<RTYPE>);
+        R_set_altvec_Dataptr_method(cls, lazy_Dataptr<RTYPE>);
+        R_set_altvec_Dataptr_or_null_method(cls, lazy_Dataptr_or_null);
+    }
+
+    static R_altrep_class_t* lazy_class(int rtype) {
+        switch (rtype) {
+        case REALSXP: return &lazy_real_class;
+        case INTSXP:  return &lazy_integer_class;
+        case LGLSXP:  return &lazy_logical_class;
+        default:      return NULL;
+        }
+    }
+
+    static bool lazy_registered_pending(SEXP ref) {
+        SEXP x = R_WeakRefValue(ref);
+        return x != R_NilValue && R_altrep_data2(x) == R_NilValue;
+    }
+
+    static void lazy_prune() {
+        SEXP prev = lazy_registry;
+        R_xlen_t n = 0;
+        for (SEXP node = CDR(prev); node != R_NilValue; node = CDR(node)) {
+            if (lazy_registered_pending(CAR(node))) {
+                prev = node;
+                n++;
+            } else {
+                SETCDR(prev, CDR(node));
+            }
+        }
+        lazy_registered = n;
+        lazy_prune_at = std::max<R_xlen_t>(64, 2 * n);
+    }
+
+    SEXP make_lazy_vector(int rtype, void* source, const void* library) {
+        R_altrep_class_t* cls = lazy_class(rtype);
+        if (cls == NULL) {
+            Rf_error("lazy vectors of type %s are not supported", Rf_type2char(rtype));  // #nocov
+        }
+        SEXP xp = PROTECT(R_MakeExternalPtr(source, R_NilValue, R_NilValue));
+        switch (rtype) {
+        case REALSXP: R_RegisterCFinalizerEx(xp, lazy_finalizer<REALSXP>, FALSE); break;
+        case INTSXP:  R_RegisterCFinalizerEx(xp, lazy_finalizer<INTSXP>, FALSE); break;
+        default:      R_RegisterCFinalizerEx(xp, lazy_finalizer<LGLSXP>, FALSE); break;
+        }
+        SEXP res = PROTECT(R_new_altrep(*cls, xp, R_NilValue));
+        if (lazy_registered >= lazy_prune_at) lazy_prune();
+        SEXP ref = PROTECT(R_MakeWeakRef(xp, res, R_NilValue, FALSE));
+        SEXP node = PROTECT(Rf_cons(ref, CDR(lazy_registry)));
+        SET_TAG(node, R_MakeExternalPtr(const_cast<void*>(library), R_NilValue, R_NilValue));
+        SETCDR(lazy_registry, node);
+        lazy_registered++;
+        UNPROTECT(4);
+        return res;
+    }
+
+    // The file of the library that holds the address p, with forward
+    // slashes on Windows, or "" if it cannot be told
+    static std::string lazy_library_path(const void* p) {
+#if defined(_WIN32)
+        HMODULE module;
+        char path[MAX_PATH];
+        if (!GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS |
+                                GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+                                static_cast<LPCSTR>(p), &module)) return std::string();
+        DWORD n = GetModuleFileNameA(module, path, MAX_PATH);
+        std::string res(path, n < MAX_PATH ? n : 0);
+        std::replace(res.begin(), res.end(), '\\', '/');
+        return res;
+#else
+        Dl_info info;
+        if (dladdr(p, &info) == 0 || info.dli_fname == NULL) return std::string();
+        char* real = realpath(info.dli_fname, NULL);
+        if (real == NULL) return std::string(info.dli_fname);
+        std::string res(real);
+        free(real);
+        return res;
+#endif
+    }
+
+    static bool lazy_same_path(const std::string& x, const char* y) {
+#if defined(_WIN32)
+        return _stricmp(x.c_str(), y) == 0;
+#else
+        return x == y;
+#endif
+    }
+
+    // Computes the pending lazy vectors made by the given library, found
+    // from its identifying address or, when that is NULL, from its path,
+    // so that none of them calls into it anymore. A source that throws
+    // leaves its vector full of NA, and its message in failures; raising
+    // a warning is left to the caller, which may be an R_unload routine.
+    static void lazy_compute_library(const void* library, const char* path,
+                                     std::vector<std::string>& failures) {
+        // the paths of the libraries seen so far, each looked up once
+        std::vector<std::pair<const void*, bool> > seen;
+        for (SEXP node = CDR(lazy_registry); node != R_NilValue; node = CDR(node)) {
+            if (!lazy_registered_pending(CAR(node))) continue;
+            const void* owner = R_ExternalPtrAddr(TAG(node));
+            bool mine = owner == library;
+            if (library == NULL) {
+                size_t k = 0;
+                while (k < seen.size() && seen[k].first != owner) k++;
+                if (k == seen.size()) {
+                    seen.push_back(std::make_pair(owner, lazy_same_path(lazy_library_path(owner), path)));
+                }
+                mine = seen[k].second;
+            }
+            if (!mine) continue;
+            SEXP x = PROTECT(R_WeakRefValue(CAR(node)));
+            bool ok;
+            switch (TYPEOF(x)) {
+            case REALSXP: ok = lazy_compute<REALSXP>(x, true); break;
+            case INTSXP:  ok = lazy_compute<INTSXP>(x, true); break;
+            default:      ok = lazy_compute<LGLSXP>(x, true); break;
+            }
+            if (!ok) failures.push_back(lazy_error_buffer);
+            UNPROTECT(1);
+        }
+        lazy_prune();
+    }
+
+    int compute_pending_lazy_vectors(const void* library) {
+        std::vector<std::string> failures;
+        lazy_compute_library(library, NULL, failures);
+        return static_cast<int>(failures.size());
+    }
+
+    bool lazy_vector_pending(SEXP x) {
+        if (!ALTREP(x)) return false;
+        R_altrep_class_t* cls = lazy_class(TYPEOF(x));
+        return cls != NULL && R_altrep_inherits(x, *cls) && R_altrep_data2(x) == R_NilValue;
+    }
+
+} // namespace internal
+} // namespace Rcpp
+
+void init_Rcpp_altrep(DllInfo* dll) {
+    using namespace Rcpp::internal;
+
+    lazy_registry = Rf_cons(R_NilValue, R_NilValue);
+    R_PreserveObject(lazy_registry);
+
+    lazy_real_class = R_make_altreal_class("lazy_real", "Rcpp", dll);
+    lazy_set_common_methods<REALSXP>(lazy_real_class);
+    R_set_altreal_Elt_method(lazy_real_class, lazy_Elt<REALSXP>);
+    R_set_altreal_Get_region_method(lazy_real_class, lazy_Get_region<REALSXP>);
+
+    lazy_integer_class = R_make_altinteger_class("lazy_integer", "Rcpp", dll);
+    lazy_set_common_methods<INTSXP>(lazy_integer_class);
+    R_set_altinteger_Elt_method(lazy_integer_class, lazy_Elt<INTSXP>);
+    R_set_altinteger_Get_region_method(lazy_integer_class, lazy_Get_region<INTSXP>);
+
+    lazy_logical_class = R_make_altlogical_class("lazy_logical", "Rcpp", dll);
+    lazy_set_common_methods<LGLSXP>(lazy_logical_class);
+    R_set_altlogical_Elt_method(lazy_logical_class, lazy_Elt<LGLSXP>);
+    R_set_altlogical_Get_region_method(lazy_logical_class, lazy_Get_region<LGLSXP>);
+}
+
+#else
+
+void init_Rcpp_altrep(DllInfo*) {}					// #nocov
+
+#endif
+
+// called by sourceCpp() before it unloads the library at path, which
+// must be normalized; returns the messages of the sources that threw
+SEXP rcpp_compute_lazy_vectors(SEXP path) {
+    std::vector<std::string> failures;
+#if defined(RCPP_HAS_ALTREP)
+    Rcpp::internal::lazy_compute_library(NULL, CHAR(STRING_ELT(path, 0)), failures);
+#endif
+    return Rcpp::wrap(failures);
+}
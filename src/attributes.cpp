@@ -155,6 +155,8 @@ namespace attributes {
     const char * const kExportRng = "rng";
     const char * const kExportInvisible = "invisible";
     const char * const kExportSignature = "signature";
+    const char * const kExportFast = "fast";
+    const char * const kExportCheck = "check";
     const char * const kInitAttribute = "init";
     const char * const kDependsAttribute = "depends";
     const char * const kPluginsAttribute = "plugins";
@@ -244,16 +246,18 @@ namespace attributes {
     // Function info
     class Function {
     public:
-        Function() {}
+        Function() : isNoexcept_(false) {}
         Function(const Type& type,
                  const std::string& name,
-                 const std::vector<Argument>& arguments)
-            : type_(type), name_(name), arguments_(arguments)
+                 const std::vector<Argument>& arguments,
+                 bool isNoexcept = false)
+            : type_(type), name_(name), arguments_(arguments),
+              isNoexcept_(isNoexcept)
         {
         }
 
         Function renamedTo(const std::string& name) const {	// #nocov start
-            return Function(type(), name, arguments());
+            return Function(type(), name, arguments(), isNoexcept());
         }
 
         std::string signature() const { return signature(name()); }
@@ -278,11 +282,13 @@ namespace attributes {
         const Type& type() const { return type_; }
         const std::string& name() const { return name_; }
         const std::vector<Argument>& arguments() const { return arguments_; }
+        bool isNoexcept() const { return isNoexcept_; }
 
     private:
         Type type_;
         std::string name_;
         std::vector<Argument> arguments_;
+        bool isNoexcept_;
     };
 
     // Attribute parameter (with optional value)
@@ -382,7 +388,7 @@ namespace attributes {
                 return rngParam.value() == kParamValueTrue ||
                        rngParam.value() == kParamValueTRUE;  
             else
-                return true;
+                return !fast();
         }
 
         bool invisible() const {
@@ -394,6 +400,28 @@ namespace attributes {
                 return false;
         }
 
+        // check = true asks for the arguments to be checked against
+        // descriptors of their types before any of them is converted
+        bool check() const {
+            Param checkParam = paramNamed(kExportCheck);
+            if (!checkParam.empty())
+                return checkParam.value() == kParamValueTrue ||
+                       checkParam.value() == kParamValueTRUE;
+            else
+                return false;
+        }
+
+        // fast = true asks for a minimal wrapper: no RNG scope unless
+        // rng = true is also given, no RObject holding the result
+        bool fast() const {
+            Param fastParam = paramNamed(kExportFast);
+            if (!fastParam.empty())
+                return fastParam.value() == kParamValueTrue ||
+                       fastParam.value() == kParamValueTRUE;
+            else
+                return false;
+        }
+
         const std::vector<std::string>& roxygen() const { return roxygen_; }
 
         std::string customRSignature() const {
@@ -1132,6 +1160,8 @@ namespace attributes {
                     os << ", ";
             }
             os << ")";
+            if (function.isNoexcept())
+                os << " noexcept";
         }
     }
 
@@ -1387,7 +1417,9 @@ namespace attributes {
                          (name != kExportName) &&
                          (name != kExportRng) &&
                          (name != kExportInvisible) &&
-                         (name != kExportSignature)) {
+                         (name != kExportSignature) &&
+                         (name != kExportFast) &&
+                         (name != kExportCheck)) {
                     rcppExportWarning("Unrecognized parameter '" + name + "'",
                                       lineNumber);
                 }
@@ -1411,6 +1443,26 @@ namespace attributes {
                                           lineNumber);			// #nocov end
                     }
                 }
+                // fast that isn't true or false
+                else if (name == kExportFast) {
+                    if (value != kParamValueFalse &&
+                        value != kParamValueTrue &&
+                        value != kParamValueFALSE &&
+                        value != kParamValueTRUE) {
+                        rcppExportWarning("fast value must be true or false",	// #nocov
+                                          lineNumber);			// #nocov
+                    }
+                }
+                // check that isn't true or false
+                else if (name == kExportCheck) {
+                    if (value != kParamValueFalse &&
+                        value != kParamValueTrue &&
+                        value != kParamValueFALSE &&
+                        value != kParamValueTRUE) {
+                        rcppExportWarning("check value must be true or false",	// #nocov
+                                          lineNumber);			// #nocov
+                    }
+                }
             }
         }
 
@@ -1489,6 +1541,23 @@ namespace attributes {
             return Function();						// #nocov
         }
 
+        // Strip a noexcept specifier following the arguments, remembering
+        // it so that a fast wrapper can skip exception handling
+        // (noexcept(false) does not count)
+        bool isNoexcept = false;
+        std::string::size_type noexceptLoc = signature.rfind("noexcept");
+        if (noexceptLoc != std::string::npos && noexceptLoc > 0) {
+            std::string::size_type prevLoc =
+                signature.find_last_not_of(kWhitespaceChars, noexceptLoc - 1);
+            if (prevLoc != std::string::npos && signature[prevLoc] == ')') {
+                std::string rest = signature.substr(noexceptLoc + 8);
+                rest.erase(std::remove_if(rest.begin(), rest.end(), isWhitespace),
+                           rest.end());
+                isNoexcept = rest.find("(false)") != 0;
+                signature.erase(noexceptLoc);
+            }
+        }
+
         // Start at the end and look for the () that deliniates the arguments
         // (bail with an empty result if we can't find them)
         std::string::size_type endParenLoc = signature.find_last_of(')');
@@ -1604,7 +1673,7 @@ namespace attributes {
             arguments.push_back(Argument(name, type, defaultValue));
         }
 
-        return Function(type, name, arguments);
+        return Function(type, name, arguments, isNoexcept);
     }
 
 
@@ -2835,6 +2904,94 @@ namespace attributes {
         ostr << "#endif" << std::endl << std::endl;
     }
 
+    // Whether converting to or from the type can throw a C++ exception
+    bool isNothrowType(const Type& type) {
+        const std::string& name = type.name();
+        return name == "SEXP" || name == "void" ||
+               name == "double" || name == "int" || name == "bool";
+    }
+
+    // Generate the check of the arguments of a check = true wrapper: a
+    // static array of descriptors made once, checked in one pass before
+    // any argument is converted
+    void generateArgumentChecks(std::ostream& ostr, const Function& function) {
+        const std::vector<Argument>& arguments = function.arguments();
+        if (arguments.empty())
+            return;
+        ostr << "    static const Rcpp::ArgumentDescriptor rcpp_argdesc_gen[] = {"
+             << std::endl;
+        for (size_t i = 0; i<arguments.size(); i++) {
+            const Argument& argument = arguments[i];
+            ostr << "        Rcpp::describe_argument< "
+                 << argument.type().full_name() << " >(\""
+                 << argument.name() << "\")";
+            if (i != (arguments.size()-1))
+                ostr << ",";
+            ostr << std::endl;
+        }
+        ostr << "    };" << std::endl;
+        ostr << "    const SEXP rcpp_args_gen[] = { ";
+        for (size_t i = 0; i<arguments.size(); i++) {
+            ostr << arguments[i].name() << "SEXP";
+            if (i != (arguments.size()-1))
+                ostr << ", ";
+        }
+        ostr << " };" << std::endl;
+        ostr << "    Rcpp::check_arguments(rcpp_argdesc_gen, rcpp_args_gen, "
+             << arguments.size() << ");" << std::endl;
+    }
+
+    // Generate the body of a fast = true wrapper: no RObject temporary and
+    // no RNG scope (unless rng = true), the result of wrap() is returned as
+    // is. A noexcept function whose arguments are all SEXP cannot throw, so
+    // its wrapper has no exception handling at all.
+    void generateFastCpp(std::ostream& ostr, const Attribute& attribute) {
+
+        const Function& function = attribute.function();
+        const std::vector<Argument>& arguments = function.arguments();
+
+        bool needsTry = !function.isNoexcept() || attribute.rng() ||
+                        attribute.check();
+        for (size_t i = 0; i<arguments.size(); i++) {
+            if (arguments[i].type().name() != "SEXP")
+                needsTry = true;
+        }
+        if (!isNothrowType(function.type()))
+            needsTry = true;
+
+        if (needsTry)
+            ostr << "BEGIN_RCPP" << std::endl;
+        if (attribute.rng())
+            ostr << "    Rcpp::RNGScope rcpp_rngScope_gen;" << std::endl;
+        if (attribute.check())
+            generateArgumentChecks(ostr, function);
+        for (size_t i = 0; i<arguments.size(); i++) {
+            const Argument& argument = arguments[i];
+            ostr << "    Rcpp::traits::input_parameter< "
+                 << argument.type().full_name() << " >::type " << argument.name()
+                 << "(" << argument.name() << "SEXP);" << std::endl;
+        }
+
+        ostr << "    ";
+        if (!function.type().isVoid())
+            ostr << "return Rcpp::wrap(";
+        ostr << function.name() << "(";
+        for (size_t i = 0; i<arguments.size(); i++) {
+            ostr << arguments[i].name();
+            if (i != (arguments.size()-1))
+                ostr << ", ";
+        }
+        if (!function.type().isVoid())
+            ostr << ")";
+        ostr << ");" << std::endl;
+
+        if (function.type().isVoid())
+            ostr << "    return R_NilValue;" << std::endl;
+        if (needsTry)
+            ostr << "VOID_END_RCPP" << std::endl
+                 << "    return R_NilValue;" << std::endl;
+    }
+
     // Generate the C++ code required to make [[Rcpp::export]] functions
     // available as C symbols with SEXP parameters and return
     void generateCpp(std::ostream& ostr,
@@ -2880,11 +3037,22 @@ namespace attributes {
             }
             std::string args = ostrArgs.str();
             ostr << args << ") {" << std::endl;
+
+            // fast wrappers return the result of wrap() directly, and only
+            // handle exceptions when something in them may throw
+            if (!cppInterface && attribute.fast()) {
+                generateFastCpp(ostr, attribute);
+                ostr << "}" << std::endl;
+                continue;
+            }
+
             ostr << "BEGIN_RCPP" << std::endl;
             if (!function.type().isVoid())
                 ostr << "    Rcpp::RObject rcpp_result_gen;" << std::endl;
             if (!cppInterface && attribute.rng())
                 ostr << "    Rcpp::RNGScope rcpp_rngScope_gen;" << std::endl;
+            if (attribute.check())
+                generateArgumentChecks(ostr, function);
             for (size_t i = 0; i<arguments.size(); i++) {
                 const Argument& argument = arguments[i];
 
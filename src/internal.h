@@ -116,6 +116,7 @@ CALLFUN_2(Module__has_function);
 CALLFUN_2(Module__get_function);
 CALLFUN_1(Module__name);
 CALLFUN_2(CppObject__finalize);
+CALLFUN_4(class__adoptLightweightInstance);
 
 CALLFUN_0(get_rcpp_cache);
 CALLFUN_0(init_Rcpp_cache);
@@ -123,6 +124,8 @@ CALLFUN_0(init_Rcpp_cache);
 CALLFUN_1(rcpp_error_recorder);
 CALLFUN_3(CppField__get);
 CALLFUN_4(CppField__set);
+CALLFUN_3(CppField__get_many);
+CALLFUN_3(CppField__set_many);
 
 CALLFUN_0(rcpp_capabilities);
 CALLFUN_0(rcpp_can_use_cxx0x);
@@ -130,16 +133,21 @@ CALLFUN_0(rcpp_can_use_cxx11);
 
 CALLFUN_0(getRcppVersionStrings);
 
+CALLFUN_1(rcpp_compute_lazy_vectors);
+
 /* .External functions */
 EXTFUN(CppMethod__invoke);
 EXTFUN(CppMethod__invoke_void);
 EXTFUN(CppMethod__invoke_notvoid);
+EXTFUN(CppMethod__invoke_many);
 EXTFUN(InternalFunction_invoke);
 EXTFUN(Module__invoke);
 EXTFUN(class__newInstance);
+EXTFUN(class__newLightweightInstance);
 EXTFUN(class__dummyInstance);
 
 void init_Rcpp_routines(DllInfo*);
+void init_Rcpp_altrep(DllInfo*);
 
 #undef CALLFUN_0
 #undef CALLFUN_1
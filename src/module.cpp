@@ -143,6 +143,39 @@ SEXP class__newInstance(SEXP args) {
     return clazz->newInstance(cargs, nargs);
 }
 
+// the attributes of a lightweight object: its class, and the key of the
+// table of its class in .lightweight_tables
+static SEXP lightweight_object(SEXP object, SEXP cls, SEXP key) {
+    static SEXP cppclassSym = Rf_install("cppclass");
+    Rf_setAttrib(object, cppclassSym, key);
+    Rf_setAttrib(object, R_ClassSymbol, cls);
+    return object;
+}
+
+SEXP class__newLightweightInstance(SEXP args) {
+    SEXP p = CDR(args);
+
+    // the external pointer to the class
+    SEXP class_xp = CAR(p); p = CDR(p);
+    XP_Class clazz(class_xp);
+
+    // the class attribute and table key of the object
+    SEXP cls = CAR(p); p = CDR(p);
+    SEXP key = CAR(p); p = CDR(p);
+
+    UNPACK_EXTERNAL_ARGS(cargs,p)
+    Rcpp::Shield<SEXP> object(clazz->newLightweightInstance(class_xp, cargs, nargs));
+    return lightweight_object(object, cls, key);
+}
+
+// an object returned by a method, made by make_new_object() with the
+// default finalizer, turned into a lightweight object
+SEXP class__adoptLightweightInstance(SEXP class_xp, SEXP object, SEXP cls, SEXP key) {
+    XP_Class clazz(class_xp);
+    Rcpp::Shield<SEXP> res(clazz->adoptLightweightInstance(class_xp, object));
+    return lightweight_object(res, cls, key);
+}
+
 // relies on being set in .onLoad()
 SEXP rcpp_dummy_pointer = R_NilValue;
 
@@ -220,6 +253,123 @@ SEXP CppMethod__invoke_notvoid(SEXP args) {
     return clazz->invoke_notvoid(met, obj, cargs, nargs);
 }
 
+// the results of CppMethod__invoke_many as an atomic vector when they are
+// all single values of the same type without attributes
+static SEXP simplify_results(SEXP res) {
+    R_xlen_t n = Rf_xlength(res);
+    if (n == 0) return res;
+    int type = TYPEOF(VECTOR_ELT(res, 0));
+    switch (type) {
+    case LGLSXP: case INTSXP: case REALSXP: case CPLXSXP: case STRSXP: case RAWSXP:
+        break;
+    default:
+        return res;
+    }
+    for (R_xlen_t i = 0; i < n; i++) {
+        SEXP x = VECTOR_ELT(res, i);
+        if (TYPEOF(x) != type || Rf_xlength(x) != 1 || ATTRIB(x) != R_NilValue) return res;
+    }
+    Rcpp::Shield<SEXP> out(Rf_allocVector(type, n));
+    switch (type) {
+    case LGLSXP:  for (R_xlen_t i = 0; i < n; i++) LOGICAL(out)[i] = LOGICAL(VECTOR_ELT(res, i))[0]; break;
+    case INTSXP:  for (R_xlen_t i = 0; i < n; i++) INTEGER(out)[i] = INTEGER(VECTOR_ELT(res, i))[0]; break;
+    case REALSXP: for (R_xlen_t i = 0; i < n; i++) REAL(out)[i] = REAL(VECTOR_ELT(res, i))[0]; break;
+    case CPLXSXP: for (R_xlen_t i = 0; i < n; i++) COMPLEX(out)[i] = COMPLEX(VECTOR_ELT(res, i))[0]; break;
+    case STRSXP:  for (R_xlen_t i = 0; i < n; i++) SET_STRING_ELT(out, i, STRING_ELT(VECTOR_ELT(res, i), 0)); break;
+    default:      for (R_xlen_t i = 0; i < n; i++) RAW(out)[i] = RAW(VECTOR_ELT(res, i))[0]; break;
+    }
+    return out;
+}
+
+// the external pointers of a list of objects of the class clazz, either
+// reference class objects or lightweight objects
+static SEXP* module_object_pointers(Rcpp::class_Base* clazz, SEXP objects) {
+    static SEXP pointerSym = Rf_install(".pointer");
+    static SEXP cppclassSym = Rf_install(".cppclass");
+    if (TYPEOF(objects) != VECSXP) Rf_error("expecting a list of objects");
+    R_xlen_t n = Rf_xlength(objects);
+    Rcpp::Shield<SEXP> clname(Rf_mkChar(("Rcpp_" + clazz->name).c_str()));
+    SEXP* pointers = reinterpret_cast<SEXP*>(R_alloc(n + 1, sizeof(SEXP)));
+    for (R_xlen_t i = 0; i < n; i++) {
+        SEXP obj = VECTOR_ELT(objects, i);
+        SEXP xp = R_NilValue;
+        if (TYPEOF(obj) == EXTPTRSXP) {
+            SEXP cls = Rf_getAttrib(obj, R_ClassSymbol);
+            if (TYPEOF(cls) == STRSXP && Rf_length(cls) > 0 && STRING_ELT(cls, 0) == clname) xp = obj;
+        } else if (Rf_isEnvironment(obj) || TYPEOF(obj) == S4SXP) {
+            SEXP env = Rf_isEnvironment(obj) ? obj : R_getS4DataSlot(obj, ENVSXP);
+            if (env != R_NilValue) {
+                SEXP cl = Rf_findVarInFrame(env, cppclassSym);
+                if (TYPEOF(cl) == EXTPTRSXP && R_ExternalPtrAddr(cl) == clazz) xp = Rf_findVarInFrame(env, pointerSym);
+            }
+        }
+        if (TYPEOF(xp) != EXTPTRSXP) Rf_error("object %d is not an object of class '%s'", (int)(i + 1), clazz->name.c_str());
+        if (xp == rcpp_dummy_pointer) Rf_error("object %d is not initialized", (int)(i + 1));
+        pointers[i] = xp;
+    }
+    return pointers;
+}
+
+// the addresses of the objects: objects is a list of objects as above, or
+// an external pointer to a std::vector of objects of the class
+static void** module_object_addresses(Rcpp::class_Base* clazz, SEXP objects, R_xlen_t* n) {
+    if (TYPEOF(objects) == EXTPTRSXP && !OBJECT(objects)) {
+        void** res = clazz->vector_elements(objects, *n);
+        if (*n == -2)
+            Rf_error("external pointer is not a vector of objects of class '%s' made by object_vector_xptr", clazz->name.c_str());
+        if (*n < 0) Rf_error("external pointer is not valid");
+        return res;
+    }
+    SEXP* pointers = module_object_pointers(clazz, objects);
+    *n = Rf_xlength(objects);
+    void** res = reinterpret_cast<void**>(R_alloc(*n + 1, sizeof(void*)));
+    for (R_xlen_t i = 0; i < *n; i++) {
+        res[i] = R_ExternalPtrAddr(pointers[i]);
+        if (res[i] == NULL) Rf_error("object %d: external pointer is not valid", (int)(i + 1));
+    }
+    return res;
+}
+
+SEXP CppField__get_many(SEXP class_xp, SEXP fields, SEXP objects) {
+    Rcpp::class_Base* clazz = reinterpret_cast<Rcpp::class_Base*>(R_ExternalPtrAddr(class_xp));
+    if (TYPEOF(fields) != STRSXP) Rf_error("expecting a character vector of field names");
+    R_xlen_t n = 0;
+    void** addresses = module_object_addresses(clazz, objects, &n);
+    return clazz->getProperties(fields, addresses, n);
+}
+
+SEXP CppField__set_many(SEXP class_xp, SEXP objects, SEXP values) {
+    Rcpp::class_Base* clazz = reinterpret_cast<Rcpp::class_Base*>(R_ExternalPtrAddr(class_xp));
+    if (TYPEOF(values) != VECSXP || TYPEOF(Rf_getAttrib(values, R_NamesSymbol)) != STRSXP)
+        Rf_error("expecting a named list of columns");
+    R_xlen_t n = 0;
+    void** addresses = module_object_addresses(clazz, objects, &n);
+    clazz->setProperties(values, addresses, n);
+    return R_NilValue;
+}
+
+SEXP CppMethod__invoke_many(SEXP args) {
+    SEXP p = CDR(args);
+
+    // the external pointer to the class
+    SEXP class_xp = CAR(p); p = CDR(p);
+    Rcpp::class_Base* clazz = reinterpret_cast<Rcpp::class_Base*>(R_ExternalPtrAddr(class_xp));
+
+    // the name of the method
+    SEXP met = CAR(p); p = CDR(p);
+    if (TYPEOF(met) != STRSXP || Rf_length(met) != 1) Rf_error("expecting a single method name");
+
+    // the list of objects
+    SEXP objects = CAR(p); p = CDR(p);
+    SEXP* pointers = module_object_pointers(clazz, objects);
+
+    // additional arguments, recycled over the objects
+    UNPACK_EXTERNAL_ARGS(cargs,p)
+
+    Rcpp::Shield<SEXP> res(clazz->invoke_many(CHAR(STRING_ELT(met, 0)), pointers, Rf_xlength(objects), cargs, nargs));
+    return simplify_results(res);
+}
+
 namespace Rcpp{
     static Module* current_scope ;
 }
@@ -36,6 +36,7 @@ static R_CallMethodDef callEntries[]  = {
     CALLDEF(CppClass__methods,1),
 
     CALLDEF(CppObject__finalize,2),
+    CALLDEF(class__adoptLightweightInstance,4),
 
     CALLDEF(Module__classes_info,1),
     CALLDEF(Module__complete,1),
@@ -52,6 +53,8 @@ static R_CallMethodDef callEntries[]  = {
     CALLDEF(as_character_externalptr,1),
 
     CALLDEF(CppField__get,3),
+    CALLDEF(CppField__get_many,3),
+    CALLDEF(CppField__set_many,3),
     CALLDEF(CppField__set,4),
 
     CALLDEF(rcpp_capabilities,0),
@@ -59,6 +62,8 @@ static R_CallMethodDef callEntries[]  = {
     CALLDEF(rcpp_can_use_cxx11,0),
 
     CALLDEF(getRcppVersionStrings,0),
+
+    CALLDEF(rcpp_compute_lazy_vectors,1),
     {NULL, NULL, 0}
 };
 
@@ -66,9 +71,11 @@ static R_ExternalMethodDef extEntries[]  = {
     EXTDEF(CppMethod__invoke),
     EXTDEF(CppMethod__invoke_void),
     EXTDEF(CppMethod__invoke_notvoid),
+    EXTDEF(CppMethod__invoke_many),
     EXTDEF(InternalFunction_invoke),
     EXTDEF(Module__invoke),
     EXTDEF(class__newInstance),
+    EXTDEF(class__newLightweightInstance),
     EXTDEF(class__dummyInstance),
 
     {NULL, NULL, 0}
@@ -99,6 +106,11 @@ void registerFunctions(){
     RCPP_REGISTER(beginSuspendRNGSynchronization);
     RCPP_REGISTER(endSuspendRNGSynchronization);
     RCPP_REGISTER(get_Rcpp_namespace)
+#if defined(RCPP_HAS_ALTREP)
+    RCPP_REGISTER(make_lazy_vector)
+    RCPP_REGISTER(lazy_vector_pending)
+    RCPP_REGISTER(compute_pending_lazy_vectors)
+#endif
     RCPP_REGISTER(get_cache)
     RCPP_REGISTER(stack_trace)
     RCPP_REGISTER(get_string_elt)
@@ -146,4 +158,6 @@ extern "C" void R_init_Rcpp(DllInfo* dllinfo) {
     Rcpp::Rcpp_precious_init();
 
     init_Rcpp_routines(dllinfo);				// init routines
+
+    init_Rcpp_altrep(dllinfo);					// ALTREP classes of lazy vectors
 }